@@ -0,0 +1,158 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <binary.hxx>
+#include <exponential.hxx>
+#include <interpolation.hxx>
+#include <learned_index.hxx>
+#include <static_index.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Run the search on every key and return the best time per lookup out of the repetitions (ns)
+  template <typename T>
+  double Measure(const std::vector<T>& keys, const std::function<int(const T&)>& search, int repetitions = 3)
+  {
+    auto best = -1.;
+    volatile int checksum = 0;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      int sum = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto& key : keys)
+        sum += search(key);
+      const auto stop = std::chrono::steady_clock::now();
+      checksum = checksum + sum;
+
+      const auto elapsed = std::chrono::duration<double, std::nano>(stop - start).count() / keys.size();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+
+  // Run the search of all the keys at once and return the best time per lookup out of the repetitions (ns)
+  template <typename Container>
+  double MeasureBatch(const Container& keys, const std::function<void(const Container&)>& search,
+                      int repetitions = 3)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      search(keys);
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::nano>(stop - start).count() / keys.size();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the searches of random keys within sorted integers, from cache resident to memory bound sizes:
+// dichotomous BinarySearch, branchless prefetching BinarySearchBranchless, interleaved BinarySearchBatch,
+// InterpolationSearch, static EytzingerIndex, BTreeIndex and LearnedIndex - std::lower_bound as reference.
+// Then searches of close keys (sorted keys), ExponentialSearch starting from the previous result.
+int main()
+{
+  typedef std::vector<int> Container;
+  typedef Container::const_iterator IT;
+
+  const int keyCount = 1 << 20;
+  std::mt19937 generator(42);
+  std::printf("%10s %16s %16s %16s %16s %16s %16s %16s %16s\n", "size", "Binary(ns)", "Branchless(ns)",
+              "Batch(ns)", "Interpolation(ns)", "Eytzinger(ns)", "BTree(ns)", "Learned(ns)", "lower_bound(ns)");
+
+  for (int size = 1 << 10; size <= 1 << 24; size <<= 2)
+  {
+    Container values(size);
+    for (auto& value : values)
+      value = static_cast<int>(generator() >> 1);
+    std::sort(values.begin(), values.end());
+
+    Container keys(keyCount);
+    for (auto& key : keys)
+      key = (generator() & 1) ? values[generator() % size] : static_cast<int>(generator() >> 1);
+
+    const auto begin = values.cbegin();
+    const auto end = values.cend();
+    const auto binary = Measure<int>(keys, [&](const int& key) { return BinarySearch<IT>(begin, end, key); });
+    const auto branchless = Measure<int>(keys, [&](const int& key) { return BinarySearchBranchless<IT>(begin, end, key); });
+    Container indexes(keyCount);
+    const auto batch = MeasureBatch<Container>(keys, [&](const Container& batchKeys)
+      { BinarySearchBatch(begin, end, batchKeys.cbegin(), batchKeys.cend(), indexes.begin()); });
+    const auto interpolation = Measure<int>(keys, [&](const int& key)
+      { return InterpolationSearch<IT>(begin, end, key); });
+    const EytzingerIndex<int> eytzingerIndex(begin, end);
+    const auto eytzinger = Measure<int>(keys, [&](const int& key) { return eytzingerIndex.Find(key); });
+    const BTreeIndex<int> bTreeIndex(begin, end);
+    const auto bTree = Measure<int>(keys, [&](const int& key) { return bTreeIndex.Find(key); });
+    const LearnedIndex<IT> learnedIndex(begin, end);
+    const auto learned = Measure<int>(keys, [&](const int& key) { return learnedIndex.Find(key); });
+    const auto standard = Measure<int>(keys, [&](const int& key)
+      { return static_cast<int>(std::lower_bound(begin, end, key) - begin); });
+
+    std::printf("%10d %16.2f %16.2f %16.2f %16.2f %16.2f %16.2f %16.2f %16.2f\n",
+                size, binary, branchless, batch, interpolation, eytzinger, bTree, learned, standard);
+  }
+
+  std::printf("\n%10s %16s %16s %16s\n", "size", "Branchless(ns)", "Interpolation(ns)", "Exponential(ns)");
+  for (int size = 1 << 10; size <= 1 << 24; size <<= 2)
+  {
+    Container values(size);
+    for (auto& value : values)
+      value = static_cast<int>(generator() >> 1);
+    std::sort(values.begin(), values.end());
+
+    Container keys(keyCount);
+    for (auto& key : keys)
+      key = static_cast<int>(generator() >> 1);
+    std::sort(keys.begin(), keys.end());
+
+    const auto begin = values.cbegin();
+    const auto end = values.cend();
+    const auto branchless = Measure<int>(keys, [&](const int& key) { return BinarySearchBranchless<IT>(begin, end, key); });
+    const auto interpolation = Measure<int>(keys, [&](const int& key)
+      { return InterpolationSearch<IT>(begin, end, key); });
+    auto hint = begin;
+    const auto exponential = Measure<int>(keys, [&](const int& key)
+    {
+      hint = ExponentialSearchLowerBound<IT>(begin, end, hint, key);
+      return static_cast<int>(hint - begin);
+    });
+
+    std::printf("%10d %16.2f %16.2f %16.2f\n", size, branchless, interpolation, exponential);
+  }
+
+  return 0;
+}
@@ -20,6 +20,12 @@
 #include <gtest/gtest.h>
 #include <binary.hxx>
 
+// STD includes
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+
 // Testing namespace
 using namespace SHA_Search;
 
@@ -48,6 +54,14 @@ namespace {
   {
     bool operator()(const T& a, const T& b) const { return a == b; }
   };
+
+  // Strict order counting its calls
+  struct COUNTING_LESS
+  {
+    bool operator()(const int a, const int b) const { ++Count; return a < b; }
+    static int Count;
+  };
+  int COUNTING_LESS::Count = 0;
 }
 #endif /* DOXYGEN_SKIP */
 
@@ -124,3 +138,154 @@ TEST(TestSearch, BinarySearchDoubles)
     EXPECT_EQ(5, index);
   }
 }
+
+// BinarySearchLowerBound against std::lower_bound on random sorted sequences of every small size
+TEST(TestSearch, BinarySearchLowerBounds)
+{
+  std::srand(7);
+  for (int size = 0; size < 67; ++size)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % 32);
+    std::sort(sortedArray.begin(), sortedArray.end());
+
+    for (int key = -1; key < 34; ++key)
+      EXPECT_EQ(std::lower_bound(sortedArray.begin(), sortedArray.end(), key),
+                BinarySearchLowerBound<IT>(sortedArray.begin(), sortedArray.end(), key));
+  }
+
+  // Comparisons only depend on the size: ceil(log2(N)) + 1
+  for (int size = 1; size < 70; ++size)
+  {
+    Container sortedArray(size);
+    for (int i = 0; i < size; ++i)
+      sortedArray[i] = i;
+
+    int comparisons = 1;
+    while ((1 << (comparisons - 1)) < size)
+      ++comparisons;
+
+    for (int key = -1; key <= size; ++key)
+    {
+      COUNTING_LESS::Count = 0;
+      BinarySearchLowerBound<IT, COUNTING_LESS>(sortedArray.begin(), sortedArray.end(), key);
+      EXPECT_EQ(comparisons, COUNTING_LESS::Count);
+    }
+  }
+
+  // Inverse order
+  {
+    Container inverseArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    std::reverse(inverseArray.begin(), inverseArray.end());
+    const auto it = BinarySearchLowerBound<IT, std::greater<int>>(inverseArray.begin(), inverseArray.end(), 10);
+    EXPECT_EQ(8, *it);
+  }
+}
+
+// BinarySearchBranchless holds the BinarySearch contract, returning the first occurrence among duplicates
+TEST(TestSearch, BinarySearchBranchlesses)
+{
+  Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+
+  // Empty array
+  {
+    Container emptyArray = Container();
+    EXPECT_EQ(-1, BinarySearchBranchless(emptyArray.begin(), emptyArray.end(), 0));
+  }
+
+  // Every existing element, and every non-existing one in between
+  for (int key = -5; key < 370; ++key)
+  {
+    const auto it = std::find(sortedArray.begin(), sortedArray.end(), key);
+    const auto index = (it != sortedArray.end()) ? static_cast<int>(it - sortedArray.begin()) : -1;
+    EXPECT_EQ(index, BinarySearchBranchless(sortedArray.begin(), sortedArray.end(), key));
+  }
+
+  // String collection - Find letter
+  EXPECT_EQ(4, BinarySearchBranchless(OrderedStr.begin(), OrderedStr.end(), 'm'));
+  EXPECT_EQ(6, BinarySearchBranchless(OrderedStr.begin(), OrderedStr.end(), 'o'));
+  EXPECT_EQ(-1, BinarySearchBranchless(OrderedStr.begin(), OrderedStr.end(), 'z'));
+
+  // Doubles
+  {
+    std::vector<double> sortedDoubleArray
+      (SortedDoubleArray, SortedDoubleArray + sizeof(SortedDoubleArray) / sizeof(double));
+    EXPECT_EQ(2, BinarySearchBranchless(sortedDoubleArray.begin(), sortedDoubleArray.end(), 0.12));
+    EXPECT_EQ(-1, BinarySearchBranchless(sortedDoubleArray.begin(), sortedDoubleArray.end(), 8.1));
+  }
+
+  // First value when identical values
+  {
+    std::vector<double> identicalArray = std::vector<double>(10, 3.);
+    EXPECT_EQ(0, BinarySearchBranchless(identicalArray.begin(), identicalArray.end(), 3.));
+  }
+}
+
+// BinarySearchBatch against BinarySearchBranchless: vectorized (contiguous int32 / float) and portable paths,
+// with batches not multiple of kBinarySearchBatchSize
+TEST(TestSearch, BinarySearchBatches)
+{
+  std::srand(7);
+  for (int size = 0; size < 300; size += (size < 40) ? 1 : 53)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (2 * size + 1));
+    std::sort(sortedArray.begin(), sortedArray.end());
+
+    Container keys;
+    for (int key = -1; key < 2 * size + 2; ++key)
+      keys.push_back(key);
+
+    // Contiguous int32
+    {
+      Container indexes(keys.size());
+      BinarySearchBatch(sortedArray.begin(), sortedArray.end(), keys.begin(), keys.end(), indexes.begin());
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(BinarySearchBranchless(sortedArray.begin(), sortedArray.end(), keys[i]), indexes[i]);
+    }
+
+    // Contiguous float
+    {
+      const std::vector<float> sortedFloats(sortedArray.begin(), sortedArray.end());
+      const std::vector<float> floatKeys(keys.begin(), keys.end());
+      Container indexes(keys.size());
+      BinarySearchBatch(sortedFloats.begin(), sortedFloats.end(), floatKeys.begin(), floatKeys.end(), indexes.begin());
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(BinarySearchBranchless(sortedFloats.begin(), sortedFloats.end(), floatKeys[i]), indexes[i]);
+    }
+
+    // Inverse order
+    {
+      Container inverseArray(sortedArray.rbegin(), sortedArray.rend());
+      Container indexes(keys.size());
+      BinarySearchBatch<IT, IT, IT, std::greater<int>>
+        (inverseArray.begin(), inverseArray.end(), keys.begin(), keys.end(), indexes.begin());
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ((BinarySearchBranchless<IT, std::greater<int>>(inverseArray.begin(), inverseArray.end(), keys[i])),
+                  indexes[i]);
+    }
+
+    // Portable path: doubles within a deque
+    {
+      const std::deque<double> sortedDoubles(sortedArray.begin(), sortedArray.end());
+      const std::deque<double> doubleKeys(keys.begin(), keys.end());
+      std::deque<int> indexes(keys.size());
+      BinarySearchBatch(sortedDoubles.begin(), sortedDoubles.end(), doubleKeys.begin(), doubleKeys.end(),
+                        indexes.begin());
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(BinarySearchBranchless(sortedDoubles.begin(), sortedDoubles.end(), doubleKeys[i]), indexes[i]);
+    }
+  }
+
+  // Strings
+  {
+    const std::string keys = "aczmo";
+    int indexes[5];
+    BinarySearchBatch(OrderedStr.begin(), OrderedStr.end(), keys.begin(), keys.end(), indexes);
+    const int expected[] = {0, 1, -1, 4, 6};
+    for (int i = 0; i < 5; ++i)
+      EXPECT_EQ(expected[i], indexes[i]);
+  }
+}
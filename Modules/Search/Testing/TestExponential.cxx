@@ -0,0 +1,129 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <exponential.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Ordered string
+  const std::string OrderedStr = "acegmnoop";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Strict order counting its calls - number of probes of a search
+  struct COUNTING_LESS
+  {
+    bool operator()(const int a, const int b) const { ++Count; return a < b; }
+    static int Count;
+  };
+  int COUNTING_LESS::Count = 0;
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic ExponentialSearch tests from every hint
+TEST(TestSearch, ExponentialSearchBasics)
+{
+  Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+
+  // Empty array
+  {
+    Container emptyArray = Container();
+    EXPECT_EQ(-1, ExponentialSearch(emptyArray.begin(), emptyArray.end(), emptyArray.begin(), 0));
+  }
+
+  // Every existing element, and every non-existing one in between
+  for (auto hint = sortedArray.begin(); hint <= sortedArray.end(); ++hint)
+    for (int key = -5; key < 370; ++key)
+    {
+      const auto it = std::find(sortedArray.begin(), sortedArray.end(), key);
+      const auto index = (it != sortedArray.end()) ? static_cast<int>(it - sortedArray.begin()) : -1;
+      EXPECT_EQ(index, ExponentialSearch(sortedArray.begin(), sortedArray.end(), hint, key));
+    }
+
+  // String collection - Find letter, first occurrence among duplicates
+  EXPECT_EQ(4, ExponentialSearch(OrderedStr.begin(), OrderedStr.end(), OrderedStr.begin() + 8, 'm'));
+  EXPECT_EQ(6, ExponentialSearch(OrderedStr.begin(), OrderedStr.end(), OrderedStr.begin() + 8, 'o'));
+  EXPECT_EQ(6, ExponentialSearch(OrderedStr.begin(), OrderedStr.end(), OrderedStr.begin(), 'o'));
+  EXPECT_EQ(-1, ExponentialSearch(OrderedStr.begin(), OrderedStr.end(), OrderedStr.begin() + 3, 'z'));
+
+  // Inverse order
+  {
+    Container inverseArray(sortedArray.rbegin(), sortedArray.rend());
+    EXPECT_EQ(3, (ExponentialSearch<IT, std::greater<int>>
+      (inverseArray.begin(), inverseArray.end(), inverseArray.begin() + 7, 15)));
+  }
+}
+
+// ExponentialSearchLowerBound against std::lower_bound on random sorted sequences with duplicates
+TEST(TestSearch, ExponentialSearchLowerBounds)
+{
+  std::srand(7);
+  for (int size = 0; size < 100; ++size)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (size + 1));
+    std::sort(sortedArray.begin(), sortedArray.end());
+
+    for (auto hint = sortedArray.begin(); hint <= sortedArray.end(); ++hint)
+      for (int key = -1; key < size + 2; ++key)
+        EXPECT_EQ(std::lower_bound(sortedArray.begin(), sortedArray.end(), key),
+                  ExponentialSearchLowerBound(sortedArray.begin(), sortedArray.end(), hint, key));
+  }
+}
+
+// Probes only depend on the distance between the hint and the result
+TEST(TestSearch, ExponentialSearchProbes)
+{
+  Container sortedArray(1 << 20);
+  for (int i = 0; i < static_cast<int>(sortedArray.size()); ++i)
+    sortedArray[i] = 2 * i;
+
+  const auto hint = sortedArray.begin() + sortedArray.size() / 2;
+  for (int distance = 1; distance < (1 << 19); distance *= 3)
+  {
+    int log = 0;
+    while ((1 << log) <= distance)
+      ++log;
+
+    // Forward and backward
+    for (int direction = -1; direction <= 1; direction += 2)
+    {
+      const auto expected = static_cast<int>(hint - sortedArray.begin()) + direction * distance;
+      COUNTING_LESS::Count = 0;
+      EXPECT_EQ(expected, (ExponentialSearch<IT, COUNTING_LESS>
+        (sortedArray.begin(), sortedArray.end(), hint, sortedArray[expected])));
+      EXPECT_GE(2 * log + 3, COUNTING_LESS::Count);
+    }
+  }
+}
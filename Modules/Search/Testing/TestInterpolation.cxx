@@ -0,0 +1,183 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <interpolation.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Simple sorted array of floats with negative values
+  const double SortedDoubleArray[] = {-.3, 0.0, 0.12, 2.5, 8};
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Strict order counting its calls - number of probes of a search
+  template <typename T>
+  struct COUNTING_LESS
+  {
+    bool operator()(const T& a, const T& b) const { ++Count; return a < b; }
+    static int Count;
+  };
+  template <typename T> int COUNTING_LESS<T>::Count = 0;
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic InterpolationSearch tests on sorted arrays
+TEST(TestSearch, InterpolationSearchBasics)
+{
+  Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+
+  // Empty array
+  {
+    Container emptyArray = Container();
+    EXPECT_EQ(-1, InterpolationSearch(emptyArray.begin(), emptyArray.end(), 0));
+  }
+
+  // Every existing element, and every non-existing one in between
+  for (int key = -5; key < 370; ++key)
+  {
+    const auto it = std::find(sortedArray.begin(), sortedArray.end(), key);
+    const auto index = (it != sortedArray.end()) ? static_cast<int>(it - sortedArray.begin()) : -1;
+    EXPECT_EQ(index, InterpolationSearch(sortedArray.begin(), sortedArray.end(), key));
+  }
+
+  // Doubles
+  {
+    std::vector<double> sortedDoubleArray
+      (SortedDoubleArray, SortedDoubleArray + sizeof(SortedDoubleArray) / sizeof(double));
+    EXPECT_EQ(2, InterpolationSearch(sortedDoubleArray.begin(), sortedDoubleArray.end(), 0.12));
+    EXPECT_EQ(-1, InterpolationSearch(sortedDoubleArray.begin(), sortedDoubleArray.end(), 8.1));
+  }
+
+  // First value when identical values
+  {
+    std::vector<double> identicalArray = std::vector<double>(10, 3.);
+    EXPECT_EQ(0, InterpolationSearch(identicalArray.begin(), identicalArray.end(), 3.));
+  }
+
+  // Inverse order
+  {
+    Container inverseArray(sortedArray.rbegin(), sortedArray.rend());
+    EXPECT_EQ(3, (InterpolationSearch<IT, std::greater<int>>(inverseArray.begin(), inverseArray.end(), 15)));
+    EXPECT_EQ(-1, (InterpolationSearch<IT, std::greater<int>>(inverseArray.begin(), inverseArray.end(), 16)));
+  }
+}
+
+// InterpolationSearchLowerBound against std::lower_bound on random sorted sequences with duplicates
+TEST(TestSearch, InterpolationSearchLowerBounds)
+{
+  std::srand(7);
+  for (int size = 0; size < 200; ++size)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (size + 1));
+    std::sort(sortedArray.begin(), sortedArray.end());
+
+    for (int key = -1; key < size + 2; ++key)
+      EXPECT_EQ(std::lower_bound(sortedArray.begin(), sortedArray.end(), key),
+                InterpolationSearchLowerBound(sortedArray.begin(), sortedArray.end(), key));
+  }
+}
+
+// Probes needed on uniform values, and bisection guard on a skewed distribution
+TEST(TestSearch, InterpolationSearchProbes)
+{
+  typedef COUNTING_LESS<double> Compare;
+  typedef std::vector<double>::iterator IT_DL;
+  const int size = 1 << 20;
+
+  // Nearly uniform values: far fewer probes than the 20 of a bisection
+  {
+    std::vector<double> timestamps(size);
+    for (int i = 0; i < size; ++i)
+      timestamps[i] = i * 10. + std::rand() % 7;
+
+    Compare::Count = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+      const auto index = std::rand() % size;
+      EXPECT_EQ(index, (InterpolationSearch<IT_DL, Compare>(timestamps.begin(), timestamps.end(), timestamps[index])));
+    }
+    EXPECT_GT(8000, Compare::Count);
+  }
+
+  // Skewed values, exponentially growing with an outlier: no more than twice the probes of a bisection
+  {
+    std::vector<double> skewed(size);
+    for (int i = 0; i < size; ++i)
+      skewed[i] = std::exp(i / 50000.);
+    skewed.back() = 1e300;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      const auto index = std::rand() % size;
+      Compare::Count = 0;
+      EXPECT_EQ(index, (InterpolationSearch<IT_DL, Compare>(skewed.begin(), skewed.end(), skewed[index])));
+      EXPECT_GE(2 * 20 + 4, Compare::Count);
+    }
+  }
+}
+
+// Values the interpolation cannot be computed on: bisection probes instead
+TEST(TestSearch, InterpolationSearchDegenerates)
+{
+  // Consecutive int64 timestamps (ns) beyond the double precision, rounding to the same double
+  {
+    typedef std::vector<std::int64_t>::iterator IT_64;
+    std::vector<std::int64_t> timestamps(1000);
+    for (int i = 0; i < 1000; ++i)
+      timestamps[i] = 1700000000000000000LL + i;
+
+    for (int i = 0; i < 1000; ++i)
+      EXPECT_EQ(i, InterpolationSearch(timestamps.begin(), timestamps.end(), timestamps[i]));
+    EXPECT_EQ(-1, InterpolationSearch(timestamps.begin(), timestamps.end(), timestamps.back() + 1));
+    EXPECT_EQ(timestamps.begin() + 500,
+              InterpolationSearchLowerBound<IT_64>(timestamps.begin(), timestamps.end(), timestamps[500]));
+  }
+
+  // Infinite values at both ends
+  {
+    std::vector<double> values(1, -std::numeric_limits<double>::infinity());
+    for (int i = 0; i < 1000; ++i)
+      values.push_back(i);
+    values.insert(values.end(), 100, std::numeric_limits<double>::infinity());
+
+    EXPECT_EQ(1001, InterpolationSearch(values.begin(), values.end(), std::numeric_limits<double>::infinity()));
+    EXPECT_EQ(0, InterpolationSearch(values.begin(), values.end(), -std::numeric_limits<double>::infinity()));
+    for (int i = 0; i < 1000; ++i)
+      EXPECT_EQ(i + 1, InterpolationSearch(values.begin(), values.end(), static_cast<double>(i)));
+    EXPECT_EQ(-1, InterpolationSearch(values.begin(), values.end(), 0.5));
+  }
+}
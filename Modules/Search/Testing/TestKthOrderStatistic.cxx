@@ -21,6 +21,7 @@
 #include <kth_order_statistic.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
 
 using namespace SHA_Search;
@@ -80,3 +81,62 @@ TEST(TestSearch, MinKthElement)
   IT::value_type value = *KthOrderStatistic<IT, GR_Compare>(krandomdArray.begin(), krandomdArray.end(), 1);
   EXPECT_EQ(5, value);
 }
+
+// Test kth smallest elements using the three-way partition
+TEST(TestSearch, KthOrderStatistic3Way)
+{
+  {
+    // Basic run on random array - Should return 4
+    Container krandomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_EQ(4, *KthOrderStatistic3Way<IT>(krandomdArray.begin(), krandomdArray.end(), 7));
+  }
+
+  Container ksortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+
+  // Basic run on sorted array with unique element - Should the kth element
+  EXPECT_EQ(ksortedArray.begin() + 4, KthOrderStatistic3Way<IT>(ksortedArray.begin(), ksortedArray.end(), 4));
+
+  // Empty sequence - Should return end on empty sequence
+  EXPECT_EQ(ksortedArray.begin(), KthOrderStatistic3Way<IT>(ksortedArray.begin(), ksortedArray.begin(), 0));
+
+  // k bigger than the size of the sequence - Should return end for out of scope search
+  EXPECT_EQ(ksortedArray.end(), KthOrderStatistic3Way<IT>(ksortedArray.begin(), ksortedArray.end(), 100));
+
+  // Few distinct values - Should return the kth value
+  {
+    Container duplicatesArray;
+    for (int i = 0; i < 10000; ++i)
+      duplicatesArray.push_back((i * 7919) % 20);
+    EXPECT_EQ(9, *KthOrderStatistic3Way<IT>(duplicatesArray.begin(), duplicatesArray.end(), 4500));
+    EXPECT_EQ(19, *KthOrderStatistic3Way<IT>(duplicatesArray.begin(), duplicatesArray.end(), 9999));
+  }
+
+  // Greater comparator - Should return 5 (second biggest value)
+  {
+    Container krandomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_EQ(5, (*KthOrderStatistic3Way<IT, std::greater<int>>(krandomdArray.begin(), krandomdArray.end(), 1)));
+  }
+}
+
+// Test pivot selection policies
+TEST(TestSearch, KthOrderStatisticPivotPolicies)
+{
+  // Every policy - Should return the same kth element
+  for (unsigned int k = 0; k < sizeof(RandomArrayInt) / sizeof(int); ++k)
+  {
+    Container expected(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    std::sort(expected.begin(), expected.end());
+
+    Container middle(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_EQ(expected[k], (*KthOrderStatistic<IT, std::less_equal<int>, SHA_Sort::MiddlePivot>
+                            (middle.begin(), middle.end(), k)));
+
+    Container ninther(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_EQ(expected[k], (*KthOrderStatistic<IT, std::less_equal<int>, SHA_Sort::NintherPivot>
+                            (ninther.begin(), ninther.end(), k)));
+
+    Container threeWay(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_EQ(expected[k], (*KthOrderStatistic3Way<IT, std::less<int>, SHA_Sort::MedianOfThreePivot>
+                            (threeWay.begin(), threeWay.end(), k)));
+  }
+}
@@ -0,0 +1,154 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <learned_index.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Simple sorted array of floats with negative values
+  const double SortedDoubleArray[] = {-.3, 0.0, 0.12, 2.5, 8};
+
+  typedef std::vector<int> Container;
+  typedef Container::const_iterator IT;
+
+  // Check the index lookups against std::lower_bound for every key within [low, high)
+  void CheckIndex(const Container& sorted, int low, int high, int maxError, int radixBits)
+  {
+    const LearnedIndex<IT> index(sorted.begin(), sorted.end(), maxError, radixBits);
+    for (int key = low; key < high; ++key)
+    {
+      const auto it = std::lower_bound(sorted.begin(), sorted.end(), key);
+      const auto found = (it != sorted.end() && *it == key) ? static_cast<int>(it - sorted.begin()) : -1;
+
+      EXPECT_EQ(it, index.LowerBound(key));
+      EXPECT_EQ(found, index.Find(key));
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic LearnedIndex lookups
+TEST(TestSearch, LearnedIndexBasics)
+{
+  // Empty index
+  {
+    const Container emptyArray;
+    const LearnedIndex<IT> index(emptyArray.begin(), emptyArray.end());
+    EXPECT_EQ(emptyArray.end(), index.LowerBound(0));
+    EXPECT_EQ(-1, index.Find(0));
+    EXPECT_EQ(0, index.SplineSize());
+  }
+
+  // Every existing element, and every non-existing one in between
+  {
+    const Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    CheckIndex(sortedArray, -5, 370, 0, 4);
+    CheckIndex(sortedArray, -5, 370, 2, 0);
+  }
+
+  // Doubles
+  {
+    const std::vector<double> sortedDoubleArray
+      (SortedDoubleArray, SortedDoubleArray + sizeof(SortedDoubleArray) / sizeof(double));
+    const LearnedIndex<std::vector<double>::const_iterator> index(sortedDoubleArray.begin(), sortedDoubleArray.end());
+    EXPECT_EQ(2, index.Find(0.12));
+    EXPECT_EQ(-1, index.Find(0.13));
+    EXPECT_EQ(-1, index.Find(8.1));
+  }
+
+  // First value when identical values
+  {
+    const std::vector<double> identicalArray = std::vector<double>(10, 3.);
+    const LearnedIndex<std::vector<double>::const_iterator> index(identicalArray.begin(), identicalArray.end());
+    EXPECT_EQ(0, index.Find(3.));
+    EXPECT_EQ(1, index.SplineSize());
+  }
+}
+
+// LearnedIndex against std::lower_bound on random sorted sequences, for several errors and table sizes
+TEST(TestSearch, LearnedIndexSequences)
+{
+  std::srand(7);
+  for (int size = 1; size < 2000; size += (size < 50) ? 1 : 311)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (3 * size));
+    std::sort(sortedArray.begin(), sortedArray.end());
+
+    for (int maxError = 0; maxError < 40; maxError = 2 * maxError + 1)
+      CheckIndex(sortedArray, -1, 3 * size + 1, maxError, 6);
+  }
+
+  // Long runs of duplicates: lower bounds of absent keys out of the window
+  {
+    Container sortedArray;
+    for (int i = 0; i < 50; ++i)
+      sortedArray.insert(sortedArray.end(), (i % 7 == 0) ? 500 : 1, 10 * i);
+    CheckIndex(sortedArray, -1, 500, 2, 4);
+  }
+}
+
+// Model size traded against the error: nearly uniform timestamps need a handful of knots
+TEST(TestSearch, LearnedIndexModels)
+{
+  const int size = 1 << 20;
+  std::vector<std::int64_t> timestamps(size);
+  for (int i = 0; i < size; ++i)
+    timestamps[i] = 1500000000000LL + i * 1000LL + std::rand() % 10;
+
+  typedef std::vector<std::int64_t>::const_iterator IT_64;
+  const LearnedIndex<IT_64> index(timestamps.begin(), timestamps.end(), 32, 10);
+  EXPECT_EQ(32, index.MaxError());
+  EXPECT_GE(4, index.SplineSize());
+  EXPECT_EQ(index.SplineSize() * 2 * sizeof(double) + ((1 << 10) + 1) * sizeof(std::uint32_t), index.ModelSize());
+  for (int i = 0; i < size; i += 997)
+  {
+    EXPECT_EQ(i, index.Find(timestamps[i]));
+    EXPECT_EQ(-1, index.Find(timestamps[i] + 10));
+  }
+
+  // Skewed distribution: a tighter error requires more knots
+  std::vector<double> skewed(size);
+  for (int i = 0; i < size; ++i)
+    skewed[i] = std::exp(i / 50000.);
+
+  typedef std::vector<double>::const_iterator IT_DL;
+  const LearnedIndex<IT_DL> coarseIndex(skewed.begin(), skewed.end(), 256);
+  const LearnedIndex<IT_DL> fineIndex(skewed.begin(), skewed.end(), 4);
+  EXPECT_LT(coarseIndex.SplineSize(), fineIndex.SplineSize());
+  for (int i = 0; i < size; i += 997)
+  {
+    EXPECT_EQ(i, coarseIndex.Find(skewed[i]));
+    EXPECT_EQ(i, fineIndex.Find(skewed[i]));
+  }
+}
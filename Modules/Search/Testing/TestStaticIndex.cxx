@@ -0,0 +1,167 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <static_index.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Ordered string
+  const std::string OrderedStr = "acegmnoop";
+
+  typedef std::vector<int> Container;
+
+  // Check the index lookups against std::lower_bound for every key within [low, high)
+  template <typename Index, typename Compare>
+  void CheckIndex(const Container& sorted, int low, int high)
+  {
+    const Index index(sorted.begin(), sorted.end());
+    EXPECT_EQ(static_cast<int>(sorted.size()), index.Size());
+
+    for (int key = low; key < high; ++key)
+    {
+      const auto it = std::lower_bound(sorted.begin(), sorted.end(), key, Compare());
+      const auto position = static_cast<int>(it - sorted.begin());
+      const auto found = (it != sorted.end() && !Compare()(key, *it)) ? position : -1;
+
+      EXPECT_EQ(position, index.LowerBound(key));
+      EXPECT_EQ(found, index.Find(key));
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic EytzingerIndex lookups
+TEST(TestSearch, EytzingerIndexBasics)
+{
+  // Empty index
+  {
+    const Container emptyArray;
+    const EytzingerIndex<int> index(emptyArray.begin(), emptyArray.end());
+    EXPECT_EQ(0, index.LowerBound(0));
+    EXPECT_EQ(-1, index.Find(0));
+  }
+
+  // Every existing element, and every non-existing one in between
+  {
+    const Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    CheckIndex<EytzingerIndex<int>, std::less<int>>(sortedArray, -5, 370);
+  }
+
+  // String collection - Find letter, first occurrence among duplicates
+  {
+    const EytzingerIndex<char> index(OrderedStr.begin(), OrderedStr.end());
+    EXPECT_EQ(4, index.Find('m'));
+    EXPECT_EQ(6, index.Find('o'));
+    EXPECT_EQ(-1, index.Find('z'));
+  }
+
+  // Strings
+  {
+    const std::vector<std::string> words = {"apple", "banana", "cherry", "date"};
+    const EytzingerIndex<std::string> index(words.begin(), words.end());
+    EXPECT_EQ(2, index.Find("cherry"));
+    EXPECT_EQ(-1, index.Find("coconut"));
+    EXPECT_EQ(3, index.LowerBound("coconut"));
+  }
+}
+
+// EytzingerIndex against std::lower_bound on random sorted sequences, complete tree or not
+TEST(TestSearch, EytzingerIndexSequences)
+{
+  std::srand(7);
+  for (int size = 1; size < 300; size += (size < 70) ? 1 : 37)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (2 * size));
+    std::sort(sortedArray.begin(), sortedArray.end());
+    CheckIndex<EytzingerIndex<int>, std::less<int>>(sortedArray, -1, 2 * size + 1);
+
+    // Inverse order
+    std::reverse(sortedArray.begin(), sortedArray.end());
+    CheckIndex<EytzingerIndex<int, std::greater<int>>, std::greater<int>>(sortedArray, -1, 2 * size + 1);
+  }
+}
+
+// Basic BTreeIndex lookups
+TEST(TestSearch, BTreeIndexBasics)
+{
+  // Empty index
+  {
+    const Container emptyArray;
+    const BTreeIndex<int> index(emptyArray.begin(), emptyArray.end());
+    EXPECT_EQ(0, index.LowerBound(0));
+    EXPECT_EQ(-1, index.Find(0));
+  }
+
+  // Every existing element, and every non-existing one in between
+  {
+    const Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    CheckIndex<BTreeIndex<int>, std::less<int>>(sortedArray, -5, 370);
+  }
+
+  // String collection - Find letter, first occurrence among duplicates
+  {
+    const BTreeIndex<char> index(OrderedStr.begin(), OrderedStr.end());
+    EXPECT_EQ(4, index.Find('m'));
+    EXPECT_EQ(6, index.Find('o'));
+    EXPECT_EQ(-1, index.Find('z'));
+  }
+
+  // Strings
+  {
+    const std::vector<std::string> words = {"apple", "banana", "cherry", "date", "elderberry"};
+    const BTreeIndex<std::string> index(words.begin(), words.end());
+    EXPECT_EQ(2, index.Find("cherry"));
+    EXPECT_EQ(-1, index.Find("coconut"));
+    EXPECT_EQ(3, index.LowerBound("coconut"));
+    EXPECT_EQ(5, index.LowerBound("fig"));
+  }
+}
+
+// BTreeIndex against std::lower_bound on random sorted sequences, over several levels with a partial last node
+TEST(TestSearch, BTreeIndexSequences)
+{
+  std::srand(7);
+  for (int size = 1; size < 5000; size += (size < 70) ? 1 : 397)
+  {
+    Container sortedArray;
+    for (int i = 0; i < size; ++i)
+      sortedArray.push_back(std::rand() % (2 * size));
+    std::sort(sortedArray.begin(), sortedArray.end());
+    CheckIndex<BTreeIndex<int>, std::less<int>>(sortedArray, -1, 2 * size + 1);
+
+    // Inverse order
+    std::reverse(sortedArray.begin(), sortedArray.end());
+    CheckIndex<BTreeIndex<int, std::greater<int>>, std::greater<int>>(sortedArray, -1, 2 * size + 1);
+  }
+}
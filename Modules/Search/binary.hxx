@@ -20,8 +20,21 @@
 #ifndef MODULE_SEARCH_BINARY_HXX
 #define MODULE_SEARCH_BINARY_HXX
 
+#include <Sort/traits.hxx>
+
 // STD includes
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
 
 namespace SHA_Search
 {
@@ -67,6 +80,321 @@ namespace SHA_Search
 
     return index;
   }
+
+  /// Binary Search Prefetch - Hint the processor to load the cache line of an element about to be compared.
+  ///
+  /// @param address address of the element.
+  ///
+  /// @return void.
+  inline void BinarySearchPrefetch(const void* address)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+  }
+
+  /// Binary Search Lower Bound - Given a sorted sequence, find the first element not ordered before a key.
+  /// Branchless: each level halves the range through a conditional move rather than a jump, so that the
+  /// number of levels only depends on the size and nothing is left to mispredict. Both elements the next
+  /// level may compare are prefetched meanwhile, overlapping the cache misses of large sequences.
+  ///
+  /// @complexity O(log N) comparisons, exactly ceil(log2(N)) + 1 on a non-empty sequence.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param key the key value to be searched.
+  ///
+  /// @return iterator to the first element not ordered before the key, end if there is none.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT BinarySearchLowerBound(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& key)
+  {
+    auto length = std::distance(begin, end);
+    if (length < 1)
+      return end;
+
+    auto base = begin;
+    while (length > 1)
+    {
+      const auto half = length / 2;
+      length -= half;
+
+      // Prefetch the middles of both halves: the one searched next is known once the comparison is done
+      BinarySearchPrefetch(&*(base + length / 2));
+      BinarySearchPrefetch(&*(base + half + length / 2));
+
+      base += static_cast<decltype(half)>(Compare()(*(base + half), key)) * half;
+    }
+
+    return base + static_cast<decltype(length)>(Compare()(*base, key));
+  }
+
+  /// Binary Search Branchless - Given a sorted sequence, find the exact position of a specific value through
+  /// the branchless lower bound (see BinarySearchLowerBound): same contract as BinarySearch, the first
+  /// occurrence being returned among equivalent elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param key the key value to be searched.
+  ///
+  /// @return The index of the first key occurence, -1 if not found.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  int BinarySearchBranchless(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& key)
+  {
+    const auto it = BinarySearchLowerBound<IT, Compare>(begin, end, key);
+    return (it != end && !Compare()(key, *it)) ? static_cast<int>(std::distance(begin, it)) : -1;
+  }
+
+  /// Number of searches run interleaved by BinarySearchBatch.
+  const int kBinarySearchBatchSize = 32;
+
+  /// BinarySearchBatchOrder - Order of the keys for the vectorized batches: 1 for std::less, -1 for
+  /// std::greater, 0 if the batch cannot be vectorized.
+  ///
+  /// @tparam Compare functor type.
+  /// @tparam Value type of the keys.
+  template <typename Compare, typename Value>
+  struct BinarySearchBatchOrder : std::integral_constant<int,
+    !std::is_same<Value, std::int32_t>::value && !std::is_same<Value, float>::value ? 0 :
+    std::is_same<Compare, std::less<Value>>::value ? 1 :
+    std::is_same<Compare, std::greater<Value>>::value ? -1 : 0>
+  {};
+
+  /// IsBinarySearchBatchVectorized - Whether a batch of searches is vectorized (AVX2 gathers): contiguous
+  /// int32 or float sequence and keys, ordered by std::less or std::greater.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam KeyIT type using to go through the keys.
+  /// @tparam Compare functor type.
+  template <typename IT,
+            typename KeyIT,
+            typename Compare,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsBinarySearchBatchVectorized : std::integral_constant<bool,
+#if defined(__AVX2__)
+    SHA_Sort::IsContiguousIterator<IT>::value && SHA_Sort::IsContiguousIterator<KeyIT>::value &&
+    std::is_same<Value, typename std::remove_cv<typename std::iterator_traits<KeyIT>::value_type>::type>::value &&
+    BinarySearchBatchOrder<Compare, Value>::value != 0
+#else
+    false
+#endif
+  >
+  {};
+
+  /// Binary Search Batch - Interleaved searches of a batch of keys (see BinarySearchBatch), portable version:
+  /// the branchless lower bound of kBinarySearchBatchSize keys is run level by level in lockstep, all of
+  /// them having the same number of levels, so that the independent cache misses overlap.
+  /// No prefetch here: the interleaved loads already keep the memory busy, prefetching both candidates
+  /// would only double the traffic.
+  template <typename IT, typename KeyIT, typename OutIT, typename Compare>
+  void BinarySearchBatch(const IT& begin, const IT& end, const KeyIT& keysBegin, const KeyIT& keysEnd,
+                         OutIT indexes, std::false_type)
+  {
+    const auto size = std::distance(begin, end);
+    const auto keyCount = std::distance(keysBegin, keysEnd);
+    typedef typename std::iterator_traits<KeyIT>::difference_type KeyDistance;
+    for (KeyDistance first = 0; first < keyCount; first += kBinarySearchBatchSize)
+    {
+      const auto count = static_cast<int>(std::min<KeyDistance>(kBinarySearchBatchSize, keyCount - first));
+      const auto keys = keysBegin + first;
+      const auto output = indexes + first;
+      if (size < 1)
+      {
+        std::fill(output, output + count, -1);
+        continue;
+      }
+
+      IT bases[kBinarySearchBatchSize];
+      std::fill(bases, bases + count, begin);
+
+      auto length = size;
+      while (length > 1)
+      {
+        const auto half = length / 2;
+        length -= half;
+
+        for (int i = 0; i < count; ++i)
+          bases[i] += static_cast<decltype(half)>(Compare()(*(bases[i] + half), keys[i])) * half;
+      }
+
+      for (int i = 0; i < count; ++i)
+      {
+        const auto it = bases[i] + static_cast<decltype(length)>(Compare()(*bases[i], keys[i]));
+        output[i] = (it != end && !Compare()(keys[i], *it)) ? static_cast<int>(std::distance(begin, it)) : -1;
+      }
+    }
+  }
+
+#if defined(__AVX2__)
+  /// Lanes of 32 bits keys for the vectorized batches.
+  ///
+  /// @tparam Value type of the keys: std::int32_t or float.
+  template <typename Value> struct BinarySearchBatchLanes;
+
+  template <> struct BinarySearchBatchLanes<std::int32_t>
+  {
+    typedef __m256i Register;
+    static Register Load(const std::int32_t* data)
+    { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+    static Register Gather(const std::int32_t* data, const __m256i offsets)
+    { return _mm256_i32gather_epi32(reinterpret_cast<const int*>(data), offsets, 4); }
+    static __m256i Less(const Register a, const Register b) { return _mm256_cmpgt_epi32(b, a); }
+  };
+
+  template <> struct BinarySearchBatchLanes<float>
+  {
+    typedef __m256 Register;
+    static Register Load(const float* data) { return _mm256_loadu_ps(data); }
+    static Register Gather(const float* data, const __m256i offsets)
+    { return _mm256_i32gather_ps(data, offsets, 4); }
+    static __m256i Less(const Register a, const Register b)
+    { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+  };
+
+  /// Compare functor on lanes: all ones where a is ordered before b.
+  template <typename Value, int Order>
+  inline __m256i BinarySearchBatchBefore(const typename BinarySearchBatchLanes<Value>::Register a,
+                                         const typename BinarySearchBatchLanes<Value>::Register b)
+  {
+    return (Order > 0) ? BinarySearchBatchLanes<Value>::Less(a, b) : BinarySearchBatchLanes<Value>::Less(b, a);
+  }
+
+  /// Binary Search Batch Group - Vectorized search of kBinarySearchBatchSize keys: the lower bound offsets
+  /// are held by registers of 8 lanes, each level gathering the middle values of all searches at once.
+  ///
+  /// @tparam Value type of the keys: std::int32_t or float.
+  /// @tparam Order 1 for std::less, -1 for std::greater.
+  ///
+  /// @param data,size the sorted sequence, not empty and of less than 2^31 elements.
+  /// @param keys the kBinarySearchBatchSize keys to be searched.
+  /// @param indexes output of the kBinarySearchBatchSize indexes, -1 for the keys not found.
+  ///
+  /// @return void.
+  template <typename Value, int Order>
+  void BinarySearchBatchGroup(const Value* data, const std::int32_t size, const Value* keys, std::int32_t* indexes)
+  {
+    typedef BinarySearchBatchLanes<Value> Lanes;
+    const int kLanes = 8;
+    const int kRegisters = kBinarySearchBatchSize / kLanes;
+
+    typename Lanes::Register values[kRegisters];
+    __m256i bases[kRegisters];
+    for (int r = 0; r < kRegisters; ++r)
+    {
+      values[r] = Lanes::Load(keys + r * kLanes);
+      bases[r] = _mm256_setzero_si256();
+    }
+
+    auto length = size;
+    while (length > 1)
+    {
+      const auto half = length / 2;
+      length -= half;
+
+      const auto halves = _mm256_set1_epi32(half);
+      for (int r = 0; r < kRegisters; ++r)
+      {
+        const auto middles = Lanes::Gather(data, _mm256_add_epi32(bases[r], halves));
+        const auto isBefore = BinarySearchBatchBefore<Value, Order>(middles, values[r]);
+        bases[r] = _mm256_add_epi32(bases[r], _mm256_and_si256(isBefore, halves));
+      }
+    }
+
+    // Last level, then check the lower bounds within the sequence are equivalent to their key
+    const auto sizes = _mm256_set1_epi32(size);
+    const auto lasts = _mm256_set1_epi32(size - 1);
+    const auto notFound = _mm256_set1_epi32(-1);
+    for (int r = 0; r < kRegisters; ++r)
+    {
+      const auto isBefore = BinarySearchBatchBefore<Value, Order>(Lanes::Gather(data, bases[r]), values[r]);
+      const auto positions = _mm256_sub_epi32(bases[r], isBefore);
+      const auto candidates = Lanes::Gather(data, _mm256_min_epi32(positions, lasts));
+      const auto found = _mm256_andnot_si256(BinarySearchBatchBefore<Value, Order>(values[r], candidates),
+                                             _mm256_cmpgt_epi32(sizes, positions));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(indexes + r * kLanes),
+                          _mm256_blendv_epi8(notFound, positions, found));
+    }
+  }
+
+  /// Binary Search Batch - Interleaved searches of a batch of keys (see BinarySearchBatch), vectorized
+  /// version: full groups of keys go through BinarySearchBatchGroup, remaining ones through the portable
+  /// version.
+  template <typename IT, typename KeyIT, typename OutIT, typename Compare>
+  void BinarySearchBatch(const IT& begin, const IT& end, const KeyIT& keysBegin, const KeyIT& keysEnd,
+                         OutIT indexes, std::true_type)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    const auto size = std::distance(begin, end);
+    const auto keyCount = std::distance(keysBegin, keysEnd);
+    if (size < 1 || size > std::numeric_limits<std::int32_t>::max())
+      return BinarySearchBatch<IT, KeyIT, OutIT, Compare>(begin, end, keysBegin, keysEnd, indexes, std::false_type());
+
+    const Value* data = &*begin;
+    const Value* keys = &*keysBegin;
+    typename std::iterator_traits<KeyIT>::difference_type first = 0;
+    for (; first + kBinarySearchBatchSize <= keyCount; first += kBinarySearchBatchSize)
+    {
+      std::int32_t groupIndexes[kBinarySearchBatchSize];
+      BinarySearchBatchGroup<Value, BinarySearchBatchOrder<Compare, Value>::value>
+        (data, static_cast<std::int32_t>(size), keys + first, groupIndexes);
+      std::copy(groupIndexes, groupIndexes + kBinarySearchBatchSize, indexes + first);
+    }
+
+    BinarySearchBatch<IT, KeyIT, OutIT, Compare>(begin, end, keysBegin + first, keysEnd, indexes + first,
+                                                 std::false_type());
+  }
+#endif
+
+  /// Binary Search Batch - Given a sorted sequence, find the exact position of each key of a batch, with
+  /// the BinarySearchBranchless contract.
+  /// Searches are run kBinarySearchBatchSize at a time, interleaved level by level: a single search waits
+  /// on the memory latency of each level, whereas the independent loads of a batch overlap, bringing the
+  /// throughput closer to the memory bandwidth on sequences bigger than the caches.
+  ///
+  /// @remark vectorized with AVX2 gathers on contiguous int32 and float sequences and keys ordered by
+  /// std::less or std::greater (see IsBinarySearchBatchVectorized).
+  ///
+  /// @complexity O(K * log N), with K the number of keys.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam KeyIT random access iterator type using to go through the keys.
+  /// @tparam OutIT random access iterator type using to go through the output indexes (int).
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param keysBegin,keysEnd iterators to the initial and final positions of the keys to be searched.
+  /// @param indexes iterator to the initial position of the output, receiving for each key the index of its
+  /// first occurence, -1 if not found.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename KeyIT,
+            typename OutIT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void BinarySearchBatch(const IT& begin, const IT& end, const KeyIT& keysBegin, const KeyIT& keysEnd,
+                         OutIT indexes)
+  {
+    BinarySearchBatch<IT, KeyIT, OutIT, Compare>(begin, end, keysBegin, keysEnd, indexes,
+      typename IsBinarySearchBatchVectorized<IT, KeyIT, Compare>::type());
+  }
 }
 
 #endif // MODULE_SEARCH_BINARY_HXX
@@ -0,0 +1,117 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SEARCH_EXPONENTIAL_HXX
+#define MODULE_SEARCH_EXPONENTIAL_HXX
+
+#include <binary.hxx>
+
+// STD includes
+#include <functional>
+#include <iterator>
+
+namespace SHA_Search
+{
+  /// Exponential Search Lower Bound - Given a sorted sequence and a hint position, find the first element
+  /// not ordered before a key.
+  /// Gallops from the hint towards the key with steps doubling each probe (1, 2, 4...) until the key is
+  /// bracketed, then bisects the last step (see BinarySearchLowerBound): the number of probes only depends on
+  /// the distance d between the hint and the result, making successive searches of close keys (e.g. merging,
+  /// searching near the previous result) much cheaper than searching the whole sequence.
+  ///
+  /// @complexity O(log d) comparisons, d being the distance between the hint and the lower bound.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param hint iterator within [begin, end] where the search starts, e.g. the previous result.
+  /// @param key the key value to be searched.
+  ///
+  /// @return iterator to the first element not ordered before the key, end if there is none.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT ExponentialSearchLowerBound(const IT& begin,
+                                 const IT& end,
+                                 const IT& hint,
+                                 const typename std::iterator_traits<IT>::value_type& key)
+  {
+    typedef typename std::iterator_traits<IT>::difference_type Distance;
+
+    // Gallop forward: the lower bound lies after the hint
+    if (hint != end && Compare()(*hint, key))
+    {
+      const auto remaining = std::distance(hint, end);
+      Distance previous = 0; // *(hint + previous) is ordered before the key
+      Distance step = 1;
+      while (step < remaining && Compare()(*(hint + step), key))
+      {
+        previous = step;
+        step *= 2;
+      }
+
+      const auto last = (step < remaining) ? hint + step + 1 : end;
+      return BinarySearchLowerBound<IT, Compare>(hint + previous + 1, last, key);
+    }
+
+    // Gallop backward: the lower bound lies before or at the hint
+    const auto preceding = std::distance(begin, hint);
+    Distance previous = 0; // *(hint - previous) is not ordered before the key (or is end)
+    Distance step = 1;
+    while (step <= preceding && !Compare()(*(hint - step), key))
+    {
+      previous = step;
+      step *= 2;
+    }
+
+    const auto first = (step <= preceding) ? hint - step + 1 : begin;
+    return BinarySearchLowerBound<IT, Compare>(first, hint - previous, key);
+  }
+
+  /// Exponential Search - Given a sorted sequence and a hint position, find the exact position of a specific
+  /// value by galloping from the hint (see ExponentialSearchLowerBound): same contract as BinarySearch, the
+  /// first occurrence being returned among equivalent elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param hint iterator within [begin, end] where the search starts, e.g. the previous result.
+  /// @param key the key value to be searched.
+  ///
+  /// @return The index of the first key occurence, -1 if not found.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  int ExponentialSearch(const IT& begin,
+                        const IT& end,
+                        const IT& hint,
+                        const typename std::iterator_traits<IT>::value_type& key)
+  {
+    const auto it = ExponentialSearchLowerBound<IT, Compare>(begin, end, hint, key);
+    return (it != end && !Compare()(key, *it)) ? static_cast<int>(std::distance(begin, it)) : -1;
+  }
+}
+
+#endif // MODULE_SEARCH_EXPONENTIAL_HXX
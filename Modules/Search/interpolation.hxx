@@ -0,0 +1,131 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SEARCH_INTERPOLATION_HXX
+#define MODULE_SEARCH_INTERPOLATION_HXX
+
+#include <binary.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace SHA_Search
+{
+  /// Range below which interpolation probes are no longer worth their division: the search is completed
+  /// by a branchless bisection.
+  const int kInterpolationSearchMinRange = 16;
+
+  /// Interpolation Search Lower Bound - Given a sorted sequence of arithmetic values, find the first element
+  /// not ordered before a key.
+  /// Instead of the middle, each probe is placed where the key would lie if the values were evenly
+  /// distributed between both bounds: O(log log N) probes on nearly uniform values (e.g. timestamps).
+  /// A bisection guard keeps the worst case logarithmic on bad distributions: a probe that does not
+  /// halve the range is followed by a bisection probe. Short ranges are completed by BinarySearchLowerBound.
+  ///
+  /// @complexity O(log log N) probes on uniform values, O(log N) at worst (twice a binary search).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param key the key value to be searched.
+  ///
+  /// @return iterator to the first element not ordered before the key, end if there is none.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT InterpolationSearchLowerBound(const IT& begin,
+                                   const IT& end,
+                                   const typename std::iterator_traits<IT>::value_type& key)
+  {
+    typedef typename std::iterator_traits<IT>::difference_type Distance;
+    static_assert(std::is_arithmetic<typename std::iterator_traits<IT>::value_type>::value,
+                  "InterpolationSearch requires arithmetic values");
+
+    const auto size = std::distance(begin, end);
+    if (size < 1 || !Compare()(*begin, key))
+      return begin;
+    if (Compare()(*(end - 1), key))
+      return end;
+
+    // Invariant: the lower bound lies within (low, high], *low being ordered before the key and not *high
+    Distance low = 0;
+    Distance high = size - 1;
+    bool isBisecting = false;
+    while (high - low > kInterpolationSearchMinRange)
+    {
+      const auto range = high - low;
+      Distance probe = low + range / 2;
+      if (!isBisecting)
+      {
+        // Values beyond the double precision (e.g. int64 above 2^53) or infinite ones give a non finite
+        // ratio: bisect instead
+        const auto lowValue = static_cast<double>(*(begin + low));
+        const auto ratio = (static_cast<double>(key) - lowValue) / (static_cast<double>(*(begin + high)) - lowValue);
+        if (std::isfinite(ratio))
+        {
+          const auto offset = std::min(std::max(ratio * static_cast<double>(range), 1.),
+                                       static_cast<double>(range - 1));
+          probe = low + static_cast<Distance>(offset);
+        }
+      }
+
+      if (Compare()(*(begin + probe), key))
+        low = probe;
+      else
+        high = probe;
+
+      // Bisect next if the interpolation did not halve the range
+      isBisecting = !isBisecting && 2 * (high - low) > range;
+    }
+
+    // Short range: branchless bisection
+    return BinarySearchLowerBound<IT, Compare>(begin + low + 1, begin + high, key);
+  }
+
+  /// Interpolation Search - Given a sorted sequence of arithmetic values, find the exact position of a
+  /// specific value through interpolated probes (see InterpolationSearchLowerBound): same contract as
+  /// BinarySearch, the first occurrence being returned among equivalent elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be searched. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param key the key value to be searched.
+  ///
+  /// @return The index of the first key occurence, -1 if not found.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  int InterpolationSearch(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& key)
+  {
+    const auto it = InterpolationSearchLowerBound<IT, Compare>(begin, end, key);
+    return (it != end && !Compare()(key, *it)) ? static_cast<int>(std::distance(begin, it)) : -1;
+  }
+}
+
+#endif // MODULE_SEARCH_INTERPOLATION_HXX
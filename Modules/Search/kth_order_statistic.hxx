@@ -21,8 +21,10 @@
 #define MODULE_SEARCH_MAX_KTH_ELEMENT_HXX
 
 #include <Sort/partition.hxx>
+#include <Sort/pivot.hxx>
 
 // STD includes
+#include <functional>
 #include <iterator>
 
 namespace SHA_Search
@@ -36,6 +38,7 @@ namespace SHA_Search
   /// @tparam IT Random-access iterator type.
   /// @tparam Compare functor type (std::less_equal to find kth smallest element,
   /// std::greater_equal to find the kth biggest one).
+  /// @tparam Pivot pivot selection policy (see SHA_Sort::RandomPivot, SHA_Sort::MiddlePivot...).
   ///
   /// @param begin,end - ITs to the initial and final positions of
   /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
@@ -43,7 +46,9 @@ namespace SHA_Search
   /// @param k the zero-based kth element - 0 for the biggest/smallest.
   ///
   /// @return the kth smallest IT element of the array, the end IT in case of failure.
-  template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = SHA_Sort::RandomPivot>
   IT KthOrderStatistic(const IT& begin, const IT& end, unsigned int k)
   {
     // Sequence does not contain enough elements: Could not find the k'th one.
@@ -51,7 +56,7 @@ namespace SHA_Search
     if (k >= static_cast<unsigned int>(kSize))
       return end;
 
-    auto pivot = begin + (rand() % kSize);                               // Take random pivot
+    auto pivot = Pivot::template Select<IT, Compare>(begin, end);        // Random pivot by default
     auto newPivot = SHA_Sort::Partition<IT, Compare>(begin, pivot, end); // Partition
 
     // Get the index of the pivot (i'th value)
@@ -63,10 +68,58 @@ namespace SHA_Search
 
     // Recurse search on left part if there is more than k elements within the left sequence
     // Recurse search on right otherwise
-    return (kPivotIndex > k) ? KthOrderStatistic<IT, Compare>(begin, newPivot, k)
-                             : KthOrderStatistic<IT, Compare>(newPivot, end, k - kPivotIndex);
+    return (kPivotIndex > k) ? KthOrderStatistic<IT, Compare, Pivot>(begin, newPivot, k)
+                             : KthOrderStatistic<IT, Compare, Pivot>(newPivot, end, k - kPivotIndex);
 
   }
+
+  /// Kt'h Order Statitstic 3-Way
+  /// Find the kth smallest/biggest element contained within [begin, end[ using a three-way partition:
+  /// the search stops as soon as the kth position falls within the block of elements equivalent to the pivot.
+  ///
+  /// @remark prefer this version on sequences containing many duplicates.
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  /// @warning this method changes the elements order between your iterators.
+  ///
+  /// @tparam IT Random-access iterator type.
+  /// @tparam Compare strict functor type (std::less to find kth smallest element,
+  /// std::greater to find the kth biggest one).
+  /// @tparam Pivot pivot selection policy (see SHA_Sort::RandomPivot, SHA_Sort::MiddlePivot...).
+  ///
+  /// @param begin,end - ITs to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param k the zero-based kth element - 0 for the biggest/smallest.
+  ///
+  /// @return the kth smallest IT element of the array, the end IT in case of failure.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = SHA_Sort::RandomPivot>
+  IT KthOrderStatistic3Way(const IT& begin, const IT& end, unsigned int k)
+  {
+    // Sequence does not contain enough elements: Could not find the k'th one.
+    const auto kSize = static_cast<const int>(std::distance(begin, end));
+    if (kSize < 1 || k >= static_cast<unsigned int>(kSize))
+      return end;
+
+    const auto kth = begin + k;
+    auto first = begin;
+    auto last = end;
+    while (true)
+    {
+      const auto pivot = Pivot::template Select<IT, Compare>(first, last);            // Random pivot by default
+      const auto equalRange = SHA_Sort::Partition3<IT, Compare>(first, pivot, last);  // Partition
+
+      // Keep searching on the partition containing the k'th position - found if within the equal block
+      if (kth < equalRange.first)
+        last = equalRange.first;
+      else if (kth >= equalRange.second)
+        first = equalRange.second;
+      else
+        return kth;
+    }
+  }
 }
 
 #endif // MODULE_SEARCH_MAX_KTH_ELEMENT_HXX
@@ -0,0 +1,268 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SEARCH_LEARNED_INDEX_HXX
+#define MODULE_SEARCH_LEARNED_INDEX_HXX
+
+#include <binary.hxx>
+#include <exponential.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace SHA_Search
+{
+  /// Default maximal distance between the position predicted by a LearnedIndex and the actual one.
+  const int kLearnedIndexMaxError = 32;
+
+  /// Default number of bits of the LearnedIndex radix table.
+  const int kLearnedIndexRadixBits = 16;
+
+  /// @class LearnedIndex
+  ///
+  /// Learned search index (radix spline) over a sorted sequence of arithmetic values, kept in place:
+  /// the position of a key is predicted by a piecewise-linear model of the sequence (position as a function
+  /// of the key), then searched by a bisection within the error window around the prediction.
+  /// - The model is a spline fitted in one pass (greedy spline corridor): a knot is added each time the
+  ///   segment from the last knot can no longer keep every key position within maxError.
+  /// - A radix table, indexed by the leading bits of the normalized key, gives the few knots the key may
+  ///   fall between, so that the segment is found in a couple of probes.
+  /// The search of a key then touches the table, two knots and the log2(2 * maxError) elements of the
+  /// window, instead of the log2(N) levels of a binary search over the whole sequence.
+  ///
+  /// @advantages
+  /// - Model size and latency are traded through maxError and radixBits: smooth distributions (e.g. nearly
+  ///   uniform timestamps) only need a handful of knots.
+  /// - The sequence is neither copied nor re-laid out.
+  ///
+  /// @drawbacks
+  /// - Read-only: any update of the sequence requires to build the index again.
+  /// - Arithmetic values in increasing order only.
+  ///
+  /// @remark the window is guaranteed to hold the indexed keys; a key absent from the sequence, following a
+  /// long run of duplicates, may have its lower bound outside of the window: the search then gallops from
+  /// the window edge (see ExponentialSearchLowerBound).
+  ///
+  /// @tparam IT type using to go through the collection.
+  template <typename IT>
+  class LearnedIndex
+  {
+    typedef typename std::iterator_traits<IT>::value_type Value;
+    typedef typename std::iterator_traits<IT>::difference_type Distance;
+    static_assert(std::is_arithmetic<Value>::value, "LearnedIndex requires arithmetic values");
+
+    public:
+      /// Build the index over a sorted sequence.
+      ///
+      /// @complexity O(N + 2^radixBits).
+      ///
+      /// @param begin,end iterators to the initial and final positions of
+      /// the sorted sequence to be indexed. The range used is [first,last), which contains all the elements
+      /// between first and last, including the element pointed by first but not the element pointed by last.
+      /// The sequence must outlive the index and remain unchanged.
+      /// @param maxError maximal distance between the predicted position of a key and its position.
+      /// @param radixBits number of bits of the radix table (2^radixBits entries).
+      ///
+      /// @warning the algorithm does not check the validity on data order: values must be sorted in increasing
+      /// order.
+      LearnedIndex(const IT& begin,
+                   const IT& end,
+                   int maxError = kLearnedIndexMaxError,
+                   int radixBits = kLearnedIndexRadixBits)
+        : begin(begin), end(end), maxError(maxError < 0 ? 0 : maxError), minKey(0.), radixScale(0.),
+          radixTable(2, 0)
+      {
+        if (begin == end)
+          return;
+
+        this->minKey = static_cast<double>(*begin);
+        this->BuildSpline();
+        this->BuildRadixTable(radixBits < 0 ? 0 : radixBits);
+      }
+
+      /// @return maximal distance between the predicted position of a key and its position.
+      int MaxError() const { return this->maxError; }
+
+      /// @return number of knots of the spline.
+      int SplineSize() const { return static_cast<int>(this->knotKeys.size()); }
+
+      /// @return memory used by the model: spline knots and radix table (bytes).
+      std::size_t ModelSize() const
+      {
+        return this->knotKeys.size() * sizeof(double) + this->knotPositions.size() * sizeof(double) +
+               this->radixTable.size() * sizeof(std::uint32_t);
+      }
+
+      /// Find the first element of the sequence not ordered before a given key.
+      ///
+      /// @complexity O(log maxError).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return iterator to the first element not ordered before the key, end if there is none.
+      IT LowerBound(const Value& key) const
+      {
+        if (this->begin == this->end || !(*this->begin < key))
+          return this->begin;
+        if (*(this->end - 1) < key)
+          return this->end;
+
+        // Bisect the window around the prediction - one more position before the lower bound of absent keys
+        const auto size = std::distance(this->begin, this->end);
+        const auto prediction = this->Predict(key);
+        const auto first = this->begin + std::max<Distance>(0, prediction - this->maxError - 1);
+        const auto last = this->begin + std::min<Distance>(size, prediction + this->maxError + 2);
+        const auto it = BinarySearchLowerBound(first, last, key);
+
+        // Lower bound outside of the window: gallop from its edge
+        if ((it == first && first != this->begin && !(*(first - 1) < key)) ||
+            (it == last && last != this->end && *last < key))
+          return ExponentialSearchLowerBound(this->begin, this->end, it, key);
+
+        return it;
+      }
+
+      /// Find the exact position of a specific key, with the BinarySearch contract.
+      ///
+      /// @complexity O(log maxError).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return The index of the first key occurence, -1 if not found.
+      int Find(const Value& key) const
+      {
+        const auto it = this->LowerBound(key);
+        return (it != this->end && !(key < *it)) ? static_cast<int>(std::distance(this->begin, it)) : -1;
+      }
+
+    private:
+      // Greedy spline corridor over the first occurrence of each distinct key: the cone of the slopes from
+      // the last knot keeping every point within maxError narrows point after point; the previous point
+      // becomes a knot once the current one falls outside of the cone
+      void BuildSpline()
+      {
+        const auto error = static_cast<double>(this->maxError);
+        double baseKey = 0., basePosition = 0.;
+        double previousKey = 0., previousPosition = 0.;
+        double upperSlope = 0., lowerSlope = 0.;
+        this->AddKnot(baseKey, basePosition);
+
+        bool hasCorridor = false;
+        Distance position = 1;
+        for (auto it = this->begin + 1; it != this->end; ++it, ++position)
+        {
+          // Duplicates: the first occurrence is the lower bound
+          if (!(*(it - 1) < *it))
+            continue;
+
+          const auto key = this->Normalize(*it);
+          const auto keyPosition = static_cast<double>(position);
+          if (hasCorridor)
+          {
+            const auto slope = (keyPosition - basePosition) / (key - baseKey);
+            if (slope > upperSlope || slope < lowerSlope)
+            {
+              this->AddKnot(previousKey, previousPosition);
+              baseKey = previousKey;
+              basePosition = previousPosition;
+              hasCorridor = false;
+            }
+          }
+
+          const auto upper = (keyPosition + error - basePosition) / (key - baseKey);
+          const auto lower = (keyPosition - error - basePosition) / (key - baseKey);
+          upperSlope = (!hasCorridor || upper < upperSlope) ? upper : upperSlope;
+          lowerSlope = (!hasCorridor || lower > lowerSlope) ? lower : lowerSlope;
+          hasCorridor = true;
+
+          previousKey = key;
+          previousPosition = keyPosition;
+        }
+
+        if (hasCorridor)
+          this->AddKnot(previousKey, previousPosition);
+      }
+
+      // Radix table: entry b holds the first knot whose normalized key has its leading bits >= b
+      void BuildRadixTable(int radixBits)
+      {
+        const auto buckets = static_cast<std::size_t>(1) << radixBits;
+        const auto maxKey = this->knotKeys.back();
+        this->radixScale = (maxKey > 0.) ? static_cast<double>(buckets) / maxKey : 0.;
+        this->radixTable.resize(buckets + 1);
+
+        std::size_t knot = 0;
+        for (std::size_t bucket = 0; bucket < this->radixTable.size(); ++bucket)
+        {
+          while (knot < this->knotKeys.size() && this->Bucket(this->knotKeys[knot]) < bucket)
+            ++knot;
+          this->radixTable[bucket] = static_cast<std::uint32_t>(knot);
+        }
+      }
+
+      // Interpolate the position of a key within (first key, last key] on its spline segment
+      Distance Predict(const Value& value) const
+      {
+        const auto key = this->Normalize(value);
+        const auto bucket = this->Bucket(key);
+
+        // First knot not ordered before the key, between the knots of the bucket and the next one
+        const auto knots = this->knotKeys.begin();
+        const auto last = std::min<std::size_t>(this->radixTable[bucket + 1] + 1, this->knotKeys.size());
+        const auto knot = static_cast<std::size_t>(
+          BinarySearchLowerBound(knots + this->radixTable[bucket], knots + last, key) - knots);
+        if (knot == 0)
+          return 0;
+
+        const auto key0 = this->knotKeys[knot - 1], position0 = this->knotPositions[knot - 1];
+        const auto key1 = this->knotKeys[knot], position1 = this->knotPositions[knot];
+        return static_cast<Distance>(position0 + (key - key0) * (position1 - position0) / (key1 - key0) + .5);
+      }
+
+      double Normalize(const Value& value) const { return static_cast<double>(value) - this->minKey; }
+
+      std::size_t Bucket(double key) const
+      {
+        const auto bucket = static_cast<std::size_t>(key * this->radixScale);
+        return std::min(bucket, this->radixTable.size() - 2);
+      }
+
+      void AddKnot(double key, double position)
+      {
+        this->knotKeys.push_back(key);
+        this->knotPositions.push_back(position);
+      }
+
+      IT begin;                               // Indexed sequence
+      IT end;
+      int maxError;                           // Maximal distance between predicted and actual positions
+      double minKey;                          // First key, origin of the normalized keys
+      double radixScale;                      // Buckets per normalized key unit
+      std::vector<double> knotKeys;           // Normalized keys of the spline knots
+      std::vector<double> knotPositions;      // Positions of the spline knots
+      std::vector<std::uint32_t> radixTable;  // First knot of each bucket
+  };
+}
+
+#endif // MODULE_SEARCH_LEARNED_INDEX_HXX
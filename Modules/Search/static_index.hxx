@@ -0,0 +1,322 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SEARCH_STATIC_INDEX_HXX
+#define MODULE_SEARCH_STATIC_INDEX_HXX
+
+#include <binary.hxx>
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace SHA_Search
+{
+  /// Size of the cache lines the static indexes are laid out for (bytes).
+  const std::size_t kStaticIndexCacheLine = 64;
+
+  /// Static Index Block - Number of keys fitting within a cache line (at least one).
+  ///
+  /// @tparam T type of the keys.
+  ///
+  /// @return number of keys per cache line.
+  template <typename T>
+  constexpr std::size_t StaticIndexBlock()
+  {
+    return (sizeof(T) < kStaticIndexCacheLine) ? kStaticIndexCacheLine / sizeof(T) : 1;
+  }
+
+  /// Static Index Offset - Offset of the first element of a buffer starting a cache line.
+  ///
+  /// @tparam T type of the keys.
+  ///
+  /// @param data buffer of keys, holding at least StaticIndexBlock<T>() elements.
+  ///
+  /// @return offset of the first cache line aligned element, 0 if keys cannot be aligned on cache lines.
+  template <typename T>
+  std::size_t StaticIndexOffset(const T* data)
+  {
+    if (kStaticIndexCacheLine % sizeof(T) != 0)
+      return 0;
+
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(data) % kStaticIndexCacheLine;
+    return ((kStaticIndexCacheLine - misalignment) % kStaticIndexCacheLine) / sizeof(T);
+  }
+
+  /// @class EytzingerIndex
+  ///
+  /// Static search index built once from a sorted sequence, whose keys are laid out in Eytzinger order:
+  /// the implicit binary search tree stored breadth first (children of the key k being 2k and 2k + 1,
+  /// from index 1) as done for binary heaps.
+  /// The first levels are shared by all searches and stay in cache, and the 2^l descendants of a key at
+  /// l levels below are contiguous: a search prefetches the cache line of its descendants a line worth of
+  /// levels ahead, each level hiding the memory latency of a later one, and chooses the child without
+  /// branching.
+  /// Each key keeps its position within the original sorted sequence, which lookups map back to.
+  ///
+  /// @advantages
+  /// - Branchless and prefetched lookups: several times faster than BinarySearch once the keys overflow
+  ///   the caches.
+  /// - Same memory as the sorted sequence, plus the sorted positions.
+  ///
+  /// @drawbacks
+  /// - Read-only: any update requires to build the index again.
+  /// - Every lookup touches the sorted position of the key found, one more cache miss.
+  ///
+  /// @tparam T type of the keys.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  template <typename T, typename Compare = std::less<T>>
+  class EytzingerIndex
+  {
+    public:
+      /// Build the index from a sorted sequence.
+      ///
+      /// @complexity O(N).
+      ///
+      /// @param begin,end iterators to the initial and final positions of
+      /// the sorted sequence to be indexed. The range used is [first,last), which contains all the elements
+      /// between first and last, including the element pointed by first but not the element pointed by last.
+      ///
+      /// @warning the algorithm does not check the validity on data order.
+      template <typename IT>
+      EytzingerIndex(const IT& begin, const IT& end)
+        : size(static_cast<std::size_t>(std::distance(begin, end))),
+          keys(size + 1 + StaticIndexBlock<T>()),
+          ranks(size + 1)
+      {
+        this->offset = StaticIndexOffset(this->keys.data());
+        this->Build(begin, 0, 1);
+      }
+
+      /// @return number of indexed keys.
+      int Size() const { return static_cast<int>(this->size); }
+
+      /// Find the position within the sorted sequence of the first key not ordered before a given key.
+      ///
+      /// @complexity O(log N).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return the sorted position of the lower bound, Size() if there is none.
+      int LowerBound(const T& key) const
+      {
+        const auto k = this->LowerBoundNode(key);
+        return k ? this->ranks[k] : static_cast<int>(this->size);
+      }
+
+      /// Find the exact position within the sorted sequence of a specific key, with the BinarySearch contract.
+      ///
+      /// @complexity O(log N).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return The sorted position of the first key occurence, -1 if not found.
+      int Find(const T& key) const
+      {
+        const auto k = this->LowerBoundNode(key);
+        return (k && !Compare()(key, this->keys[this->offset + k])) ? this->ranks[k] : -1;
+      }
+
+    private:
+      // In-order traversal of the implicit tree: assigns the sorted keys from position i to the subtree k
+      // and returns the position following them
+      template <typename IT>
+      std::size_t Build(const IT& begin, std::size_t i, std::size_t k)
+      {
+        if (k > this->size)
+          return i;
+
+        i = this->Build(begin, i, 2 * k);
+        this->keys[this->offset + k] = *(begin + i);
+        this->ranks[k] = static_cast<int>(i);
+        return this->Build(begin, i + 1, 2 * k + 1);
+      }
+
+      // Descend down to a leaf going right each time the key is greater: the lower bound is the last node
+      // the search went left from, obtained by removing the trailing right turns and the last left one
+      std::size_t LowerBoundNode(const T& key) const
+      {
+        const T* nodes = this->keys.data() + this->offset;
+        const auto block = StaticIndexBlock<T>();
+
+        std::size_t k = 1;
+        while (k <= this->size)
+        {
+          const auto ahead = k * block;
+          BinarySearchPrefetch(nodes + ((ahead <= this->size) ? ahead : 0));
+          k = 2 * k + static_cast<std::size_t>(Compare()(nodes[k], key));
+        }
+
+        return k >> (TrailingOnes(k) + 1);
+      }
+
+      static unsigned int TrailingOnes(std::size_t k)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned int>(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+        unsigned int count = 0;
+        for (; k & 1; k >>= 1)
+          ++count;
+        return count;
+#endif
+      }
+
+      std::size_t size;      // Number of indexed keys
+      std::vector<T> keys;   // Keys in Eytzinger order, from index 1 after the offset
+      std::vector<int> ranks; // Sorted position of each key
+      std::size_t offset;    // Offset aligning the keys on cache lines
+  };
+
+  /// @class BTreeIndex
+  ///
+  /// Static search index built once from a sorted sequence, whose keys are laid out as an implicit B-tree
+  /// (S-tree): each node holds the keys of a cache line and has one more child than keys, the nodes being
+  /// stored breadth first (children of the node k being k * (B + 1) + i + 1).
+  /// A lookup ranks the key within a node by counting the node keys ordered before it - a fixed size,
+  /// branchless loop the compiler vectorizes for arithmetic keys - then goes down the matching child:
+  /// exactly one cache line is touched per level, over log_(B+1)(N) levels instead of log_2(N).
+  /// Each key keeps its position within the original sorted sequence, which lookups map back to.
+  ///
+  /// @advantages
+  /// - Fewest cache misses per lookup: 4x fewer levels than a binary tree on 32 bits keys.
+  /// - Branchless ranking within nodes.
+  ///
+  /// @drawbacks
+  /// - Read-only: any update requires to build the index again.
+  /// - The last node is padded with copies of the biggest key.
+  /// - Every lookup touches the sorted position of the key found, one more cache miss.
+  ///
+  /// @tparam T type of the keys.
+  /// @tparam Compare strict functor type the sequence is sorted with (std::less in order, std::greater for
+  /// inverse order).
+  template <typename T, typename Compare = std::less<T>>
+  class BTreeIndex
+  {
+    public:
+      /// Build the index from a sorted sequence.
+      ///
+      /// @complexity O(N).
+      ///
+      /// @param begin,end iterators to the initial and final positions of
+      /// the sorted sequence to be indexed. The range used is [first,last), which contains all the elements
+      /// between first and last, including the element pointed by first but not the element pointed by last.
+      ///
+      /// @warning the algorithm does not check the validity on data order.
+      template <typename IT>
+      BTreeIndex(const IT& begin, const IT& end)
+        : size(static_cast<std::size_t>(std::distance(begin, end))),
+          nodeCount((size + StaticIndexBlock<T>() - 1) / StaticIndexBlock<T>()),
+          keys((nodeCount + 1) * StaticIndexBlock<T>()),
+          ranks(nodeCount * StaticIndexBlock<T>())
+      {
+        this->offset = StaticIndexOffset(this->keys.data());
+        this->Build(begin, 0, 0);
+      }
+
+      /// @return number of indexed keys.
+      int Size() const { return static_cast<int>(this->size); }
+
+      /// Find the position within the sorted sequence of the first key not ordered before a given key.
+      ///
+      /// @complexity O(log N).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return the sorted position of the lower bound, Size() if there is none.
+      int LowerBound(const T& key) const
+      {
+        const auto slot = this->LowerBoundSlot(key);
+        return (slot < this->ranks.size()) ? this->ranks[slot] : static_cast<int>(this->size);
+      }
+
+      /// Find the exact position within the sorted sequence of a specific key, with the BinarySearch contract.
+      ///
+      /// @complexity O(log N).
+      ///
+      /// @param key the key value to be searched.
+      ///
+      /// @return The sorted position of the first key occurence, -1 if not found.
+      int Find(const T& key) const
+      {
+        const auto slot = this->LowerBoundSlot(key);
+        return (slot < this->ranks.size() && !Compare()(key, this->keys[this->offset + slot])) ?
+          this->ranks[slot] : -1;
+      }
+
+    private:
+      // In-order traversal of the implicit tree: assigns the sorted keys from position i to the subtree k
+      // and returns the position following them - slots past the sequence copy its biggest key
+      template <typename IT>
+      std::size_t Build(const IT& begin, std::size_t i, std::size_t k)
+      {
+        const auto block = StaticIndexBlock<T>();
+        if (k >= this->nodeCount)
+          return i;
+
+        for (std::size_t j = 0; j < block; ++j)
+        {
+          i = this->Build(begin, i, k * (block + 1) + j + 1);
+
+          const auto slot = k * block + j;
+          const auto isPadding = (i >= this->size);
+          this->keys[this->offset + slot] = *(begin + (isPadding ? this->size - 1 : i));
+          this->ranks[slot] = static_cast<int>(isPadding ? this->size : i);
+          i += isPadding ? 0 : 1;
+        }
+
+        return this->Build(begin, i, k * (block + 1) + block + 1);
+      }
+
+      // Rank the key within each node down to a leaf: the lower bound is the last slot not ordered before
+      // the key met on the way (nodes deeper are closer in order)
+      std::size_t LowerBoundSlot(const T& key) const
+      {
+        const T* nodes = this->keys.data() + this->offset;
+        const auto block = StaticIndexBlock<T>();
+
+        auto slot = this->ranks.size();
+        std::size_t k = 0;
+        while (k < this->nodeCount)
+        {
+          const T* node = nodes + k * block;
+          unsigned int rank = 0;
+          for (std::size_t j = 0; j < block; ++j)
+            rank += static_cast<unsigned int>(Compare()(node[j], key));
+
+          slot = (rank < block) ? k * block + rank : slot;
+          k = k * (block + 1) + rank + 1;
+        }
+
+        return slot;
+      }
+
+      std::size_t size;       // Number of indexed keys
+      std::size_t nodeCount;  // Number of nodes, of StaticIndexBlock keys each
+      std::vector<T> keys;    // Keys node after node, after the offset
+      std::vector<int> ranks; // Sorted position of each key slot, Size() for padding
+      std::size_t offset;     // Offset aligning the nodes on cache lines
+  };
+}
+
+#endif // MODULE_SEARCH_STATIC_INDEX_HXX
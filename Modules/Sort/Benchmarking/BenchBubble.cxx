@@ -0,0 +1,99 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <bubble.hxx>
+#include <cocktail.hxx>
+#include <insertion.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<float> Container;
+  typedef Container::iterator IT;
+
+  // Sort each buffer of a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const int bufferSize, const std::function<void(IT, IT)>& function,
+                 int repetitions = 3)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      for (auto it = copy.begin(); it < copy.end(); it += bufferSize)
+        function(it, it + bufferSize);
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the adjacent swap sorts with their odd-even transposition variants on batches of small, nearly sorted
+// buffers (some neighbours swapped) - insertion sort as reference
+int main()
+{
+  const int kTotalSize = 1 << 20;
+  std::mt19937 generator(42);
+  std::printf("%10s %10s %14s %14s %18s %20s %14s\n", "buffer", "swaps", "Bubble(ms)", "Cocktail(ms)",
+              "OddEvenBubble(ms)", "OddEvenCocktail(ms)", "Insertion(ms)");
+
+  for (int swapRatio = 32; swapRatio <= 512; swapRatio <<= 4)
+    for (int bufferSize = 16; bufferSize <= 1024; bufferSize <<= 2)
+    {
+      // Sorted buffers, one element out of swapRatio swapped with its neighbour
+      Container values(kTotalSize);
+      for (int i = 0; i < kTotalSize; ++i)
+        values[i] = static_cast<float>(i % bufferSize);
+      for (int i = 0; i < kTotalSize / swapRatio; ++i)
+      {
+        const auto position = generator() % (kTotalSize - 1);
+        if ((position + 1) % bufferSize != 0)
+          std::swap(values[position], values[position + 1]);
+      }
+
+      const auto bubble = Measure(values, bufferSize, [](IT begin, IT end) { Bubble<IT>(begin, end); });
+      const auto cocktail = Measure(values, bufferSize, [](IT begin, IT end) { Cocktail<IT>(begin, end); });
+      const auto oddEvenBubble = Measure(values, bufferSize, [](IT begin, IT end)
+        { OddEvenBubble<IT>(begin, end); });
+      const auto oddEvenCocktail = Measure(values, bufferSize, [](IT begin, IT end)
+        { OddEvenCocktail<IT>(begin, end); });
+      const auto insertion = Measure(values, bufferSize, [](IT begin, IT end)
+        { InsertionSort<IT>(begin, end); });
+
+      std::printf("%10d %8s%-2d %14.3f %14.3f %18.3f %20.3f %14.3f\n", bufferSize, "1/", swapRatio, bubble,
+                  cocktail, oddEvenBubble, oddEvenCocktail, insertion);
+    }
+
+  return 0;
+}
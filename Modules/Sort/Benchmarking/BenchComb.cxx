@@ -0,0 +1,88 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <comb.hxx>
+#include <heap.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Run the function on a copy of the data and return the best time out of the repetitions (ms)
+  template <typename Container>
+  double Measure(const Container& data,
+                 const std::function<void(typename Container::iterator, typename Container::iterator)>& function,
+                 int repetitions = 3)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      function(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the O(1) memory sorts on random integers: comb sort with vectorized passes (contiguous values),
+// with scalar passes (std::deque) and heap sort - std::sort as reference
+int main()
+{
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef std::deque<int> Deque;
+  typedef Deque::iterator DequeIT;
+
+  std::mt19937 generator(42);
+  std::printf("%10s %18s %18s %18s %18s\n", "size", "Comb(ms)", "Comb deque(ms)", "HeapSort(ms)", "std::sort(ms)");
+
+  for (int size = 1 << 10; size <= 1 << 22; size <<= 2)
+  {
+    Container values(size);
+    for (auto& value : values)
+      value = static_cast<int>(generator());
+    const Deque deque(values.begin(), values.end());
+
+    const auto comb = Measure<Container>(values, [](IT begin, IT end) { Comb<IT>(begin, end); });
+    const auto combDeque = Measure<Deque>(deque, [](DequeIT begin, DequeIT end) { Comb<DequeIT>(begin, end); });
+    const auto heap = Measure<Container>(values, [](IT begin, IT end) { HeapSort<IT, std::less<int>>(begin, end); });
+    const auto standard = Measure<Container>(values, [](IT begin, IT end) { std::sort(begin, end); });
+
+    std::printf("%10d %18.3f %18.3f %18.3f %18.3f\n", size, comb, combDeque, heap, standard);
+  }
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <merge.hxx>
+#include <merge_k.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Run the sort on a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const std::function<void(IT, IT)>& sort, int repetitions = 5)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      sort(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      if (!std::is_sorted(copy.begin(), copy.end()))
+        std::printf("Error: sequence not sorted\n");
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the merge aggregators on random and nearly sorted integers
+int main()
+{
+  std::mt19937 generator(42);
+  std::printf("%10s %10s %18s %18s %18s %18s %18s %18s\n", "size", "input", "WithBuffer(ms)",
+              "WithScratch(ms)", "StableSort(ms)", "Multiway8(ms)", "WithRotations(ms)", "InPlace(ms)");
+
+  for (int size = 1 << 10; size <= 1 << 20; size <<= 2)
+  {
+    Container random(size);
+    for (auto& value : random)
+      value = static_cast<int>(generator());
+
+    Container nearlySorted(random);
+    std::sort(nearlySorted.begin(), nearlySorted.end());
+    for (int i = 0; i < size / 100; ++i)
+      std::swap(nearlySorted[generator() % size], nearlySorted[generator() % size]);
+
+    const Container* inputs[] = {&random, &nearlySorted};
+    const char* names[] = {"random", "nearly"};
+    for (int i = 0; i < 2; ++i)
+    {
+      const auto withBuffer = Measure(*inputs[i], [](IT begin, IT end)
+        { MergeSort<IT, MergeWithBuffer<IT>>(begin, end); });
+      const auto withScratch = Measure(*inputs[i], [](IT begin, IT end)
+        { MergeSortWithScratch<IT>(begin, end); });
+      const auto stable = Measure(*inputs[i], [](IT begin, IT end)
+        { StableSort<IT>(begin, end); });
+      const auto multiway = Measure(*inputs[i], [](IT begin, IT end)
+        { MultiwayMergeSort<IT>(begin, end); });
+      const auto withRotations = Measure(*inputs[i], [](IT begin, IT end)
+        { MergeSort<IT, MergeWithRotations<IT>>(begin, end); });
+
+      // Quadratic merge: only run on small sequences
+      const auto inPlace = (size <= 1 << 14) ? Measure(*inputs[i], [](IT begin, IT end)
+        { MergeSort<IT, MergeInPlace<IT>>(begin, end); }) : -1.;
+
+      std::printf("%10d %10s %18.3f %18.3f %18.3f %18.3f %18.3f %18.3f\n",
+                  size, names[i], withBuffer, withScratch, stable, multiway, withRotations, inPlace);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <partial.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<float> Container;
+  typedef Container::iterator IT;
+
+  // Run the function on a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const std::function<void(IT, IT)>& function, int repetitions = 3)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      function(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the top-k selections on random scores: full sort, partial sort and std::partial_sort
+int main()
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(0.f, 1.f);
+  std::printf("%10s %10s %18s %18s %18s %18s\n",
+              "size", "k", "QuickSort(ms)", "PartialSort(ms)", "NthElement(ms)", "std::partial(ms)");
+
+  for (int size = 1 << 16; size <= 1 << 24; size <<= 4)
+  {
+    Container scores(size);
+    for (auto& score : scores)
+      score = distribution(generator);
+
+    for (int k = 100; k <= size / 16; k *= 100)
+    {
+      const auto quick = Measure(scores, [](IT begin, IT end)
+        { QuickSort<IT, std::greater<float>>(begin, end); });
+      const auto partial = Measure(scores, [k](IT begin, IT end)
+        { PartialSort<IT, std::greater<float>>(begin, begin + k, end); });
+      const auto nth = Measure(scores, [k](IT begin, IT end)
+        { NthElement<IT, std::greater<float>>(begin, begin + k, end); });
+      const auto standard = Measure(scores, [k](IT begin, IT end)
+        { std::partial_sort(begin, begin + k, end, std::greater<float>()); });
+
+      std::printf("%10d %10d %18.3f %18.3f %18.3f %18.3f\n", size, k, quick, partial, nth, standard);
+    }
+  }
+
+  return 0;
+}
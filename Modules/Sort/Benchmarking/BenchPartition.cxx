@@ -0,0 +1,83 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <partition.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Run the function on a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const std::function<void(IT, IT)>& function, int repetitions = 5)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      function(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the partition strategies and the resulting quick sort on random integers
+int main()
+{
+  std::mt19937 generator(42);
+  std::printf("%s partition\n", IsVectorizedPartition<IT, std::less_equal<int>>::value ? "Vectorized" : "Block");
+  std::printf("%10s %14s %14s %14s %14s %14s\n",
+              "size", "Lomuto(ms)", "Block(ms)", "Partition(ms)", "QuickSort(ms)", "std::sort(ms)");
+
+  for (int size = 1 << 12; size <= 1 << 24; size <<= 2)
+  {
+    Container random(size);
+    for (auto& value : random)
+      value = static_cast<int>(generator());
+
+    const auto lomuto = Measure(random, [](IT begin, IT end) { LomutoPartition<IT>(begin, begin, end); });
+    const auto block = Measure(random, [](IT begin, IT end) { BlockPartition<IT>(begin, begin, end); });
+    const auto partition = Measure(random, [](IT begin, IT end) { Partition<IT>(begin, begin, end); });
+    const auto quick = Measure(random, [](IT begin, IT end) { QuickSort<IT>(begin, end); });
+    const auto stdSort = Measure(random, [](IT begin, IT end) { std::sort(begin, end); });
+
+    std::printf("%10d %14.3f %14.3f %14.3f %14.3f %14.3f\n", size, lomuto, block, partition, quick, stdSort);
+  }
+
+  return 0;
+}
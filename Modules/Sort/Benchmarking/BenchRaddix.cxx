@@ -0,0 +1,83 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <raddix.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Run the sort on a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const std::function<void(IT, IT)>& sort, int repetitions = 5)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      sort(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      if (!std::is_sorted(copy.begin(), copy.end()))
+        std::printf("Error: sequence not sorted\n");
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the LSD raddix sort digit sizes and the MSD American flag sort against std::sort on random integers
+int main()
+{
+  std::mt19937 generator(42);
+  std::printf("%10s %18s %18s %18s %18s\n", "size", "std::sort(ms)", "Raddix8(ms)", "Raddix11(ms)", "AmericanFlag(ms)");
+
+  for (int size = 1 << 10; size <= 1 << 24; size <<= 2)
+  {
+    Container random(size);
+    for (auto& value : random)
+      value = static_cast<int>(generator() & 0x7FFFFFFF);
+
+    const auto stdSort = Measure(random, [](IT begin, IT end) { std::sort(begin, end); });
+    const auto raddix8 = Measure(random, [](IT begin, IT end) { RaddixSort<IT, 8>(begin, end); });
+    const auto raddix11 = Measure(random, [](IT begin, IT end) { RaddixSort<IT, 11>(begin, end); });
+
+    const auto americanFlag = Measure(random, [](IT begin, IT end) { AmericanFlagSort<IT>(begin, end); });
+
+    std::printf("%10d %18.3f %18.3f %18.3f %18.3f\n", size, stdSort, raddix8, raddix11, americanFlag);
+  }
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <quick.hxx>
+#include <sort.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Run the function on a copy of the data and return the best time out of the repetitions (ms)
+  template <typename Container>
+  double Measure(const Container& data,
+                 const std::function<void(typename Container::iterator, typename Container::iterator)>& function,
+                 int repetitions = 3)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      function(copy.begin(), copy.end());
+      const auto stop = std::chrono::steady_clock::now();
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+
+  // Compare the dispatcher with the quick sort and std::sort on the given data
+  template <typename Container, typename Compare>
+  void Run(const char* name, const Container& data)
+  {
+    typedef typename Container::iterator IT;
+
+    SortStats stats;
+    Container copy(data);
+    Sort<IT, Compare>(copy.begin(), copy.end(), &stats);
+
+    const auto sort = Measure<Container>(data, [](IT begin, IT end) { Sort<IT, Compare>(begin, end); });
+    const auto quick = Measure<Container>(data, [](IT begin, IT end) { QuickSort<IT, Compare>(begin, end); });
+    const auto standard = Measure<Container>(data, [](IT begin, IT end) { std::sort(begin, end, Compare()); });
+
+    std::printf("%-22s %10d %16s %12.3f %16.3f %16.3f\n", name, static_cast<int>(data.size()),
+                SortEngineName(stats.engine), sort, quick, standard);
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the sort dispatcher with the quick sort and std::sort on several distributions
+int main()
+{
+  typedef std::vector<int> Integers;
+  typedef std::vector<std::string> Strings;
+
+  const int kSize = 1 << 20;
+  std::mt19937 generator(42);
+  std::printf("%-22s %10s %16s %12s %16s %16s\n", "distribution", "size", "engine", "Sort(ms)", "QuickSort(ms)",
+              "std::sort(ms)");
+
+  Integers random(kSize);
+  for (auto& value : random)
+    value = static_cast<int>(generator());
+  Run<Integers, std::less<int>>("int random", random);
+
+  Integers sorted(random);
+  std::sort(sorted.begin(), sorted.end());
+  Run<Integers, std::less<int>>("int sorted", sorted);
+  Run<Integers, std::greater<int>>("int reversed", sorted);
+
+  Integers nearlySorted(sorted);
+  for (int i = 0; i < kSize / 1000; ++i)
+    std::swap(nearlySorted[generator() % kSize], nearlySorted[generator() % kSize]);
+  Run<Integers, std::less<int>>("int nearly sorted", nearlySorted);
+
+  Integers fewUnique(kSize);
+  for (auto& value : fewUnique)
+    value = static_cast<int>(generator() % 16);
+  Run<Integers, std::less<int>>("int 16 values", fewUnique);
+
+  const int kStringSize = 1 << 17;
+  Strings strings(kStringSize);
+  for (auto& value : strings)
+    value = std::to_string(generator()) + "-key";
+  Run<Strings, std::less<std::string>>("string random", strings);
+  Run<Strings, std::greater<std::string>>("string random greater", strings);
+
+  Strings fewStrings(kStringSize);
+  for (auto& value : fewStrings)
+    value = std::to_string(generator() % 32) + "-key";
+  Run<Strings, std::greater<std::string>>("string 32 values", fewStrings);
+
+  Strings sortedStrings(strings);
+  std::sort(sortedStrings.begin(), sortedStrings.end());
+  Run<Strings, std::less<std::string>>("string sorted", sortedStrings);
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <insertion.hxx>
+#include <merge.hxx>
+#include <quick.hxx>
+#include <sorting_network.hxx>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Benchmarking namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Sort each block of blockSize elements of a copy of the data and return the best time out of the repetitions (ms)
+  double Measure(const Container& data, const int blockSize, const std::function<void(IT, IT)>& sort,
+                 int repetitions = 5)
+  {
+    auto best = -1.;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      Container copy(data);
+      const auto start = std::chrono::steady_clock::now();
+      for (auto block = copy.begin(); block != copy.end(); block += blockSize)
+        sort(block, block + blockSize);
+      const auto stop = std::chrono::steady_clock::now();
+
+      for (auto block = copy.begin(); block != copy.end(); block += blockSize)
+        if (!std::is_sorted(block, block + blockSize))
+        {
+          std::printf("Error: sequence not sorted\n");
+          break;
+        }
+
+      const auto elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+      best = (best < 0 || elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Compare the small sequence kernels on many independent blocks of random integers
+int main()
+{
+  const int kSize = 1 << 20;
+  std::mt19937 generator(42);
+  Container random(kSize);
+  for (auto& value : random)
+    value = static_cast<int>(generator());
+
+  std::printf("%s kernels\n", SortingNetworkHasKernel<int>::value ? "Vectorized" : "Scalar");
+  std::printf("%10s %16s %16s %16s %16s %16s\n",
+              "block", "std::sort(ms)", "Insertion(ms)", "Network(ms)", "QuickSort(ms)", "MergeSort(ms)");
+
+  for (int blockSize = 4; blockSize <= kSortingNetworkMaxSize; blockSize <<= 1)
+  {
+    const auto stdSort = Measure(random, blockSize, [](IT begin, IT end) { std::sort(begin, end); });
+    const auto insertion = Measure(random, blockSize, [](IT begin, IT end) { InsertionSort<IT>(begin, end); });
+    const auto network = Measure(random, blockSize, [](IT begin, IT end) { SmallSort<IT>(begin, end); });
+    const auto quick = Measure(random, blockSize, [](IT begin, IT end) { QuickSort<IT>(begin, end); });
+    const auto merge = Measure(random, blockSize, [](IT begin, IT end) { MergeSort<IT>(begin, end); });
+
+    std::printf("%10d %16.3f %16.3f %16.3f %16.3f %16.3f\n", blockSize, stdSort, insertion, network, quick, merge);
+  }
+
+  return 0;
+}
@@ -21,7 +21,10 @@
 #include <bubble.hxx>
 
 // STD includes
+#include <algorithm>
+#include <deque>
 #include <functional>
+#include <random>
 #include <vector>
 #include <string>
 
@@ -131,3 +134,86 @@ TEST(TestSort, BubbleGreaterComparator)
       EXPECT_GE(*it, *(it + 1));
   }
 }
+
+// Odd-even transposition Bubble tests
+TEST(TestSort, OddEvenBubbles)
+{
+  // Normal Run - Elements should be sorted, in order and in inverse order
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    OddEvenBubble<IT>(randomdArray.begin(), randomdArray.end());
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+
+    OddEvenBubble<IT, GE_Comparator>(randomdArray.begin(), randomdArray.end());
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    OddEvenBubble<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error unitialized array
+  {
+    Container emptyArray;
+    OddEvenBubble<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // String - Generic swaps
+  {
+    std::string stringToSort = RandomStr;
+    OddEvenBubble<std::string::iterator, std::greater<char>>(stringToSort.begin(), stringToSort.end());
+    EXPECT_EQ("zxvgeeca", stringToSort);
+  }
+
+  // Sequences of all sizes around the register widths - Scalar and vectorized passes
+  std::mt19937 generator(11);
+  for (int size = 2; size < 600; size = size * 2 + 1)
+  {
+    std::uniform_int_distribution<int> distribution(-size, size);
+    Container values(size);
+    for (auto& value : values)
+      value = distribution(generator);
+    Container expected = values;
+    std::sort(expected.begin(), expected.end());
+    Container sorted = values;
+    OddEvenBubble<IT>(sorted.begin(), sorted.end());
+    EXPECT_EQ(expected, sorted);
+
+    std::vector<double> doubles(values.begin(), values.end());
+    std::vector<double> expectedDoubles(doubles);
+    std::sort(expectedDoubles.begin(), expectedDoubles.end(), std::greater<double>());
+    OddEvenBubble<std::vector<double>::iterator, std::greater<double>>(doubles.begin(), doubles.end());
+    EXPECT_EQ(expectedDoubles, doubles);
+
+    std::deque<int> deque(values.begin(), values.end());
+    OddEvenBubble<std::deque<int>::iterator>(deque.begin(), deque.end());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), deque.begin()));
+  }
+
+  // Nearly sorted sequences - Elements far from their position should still reach it
+  for (int size = 3; size < 200; size += 17)
+  {
+    Container expected(size);
+    for (int i = 0; i < size; ++i)
+      expected[i] = i;
+
+    Container values = expected;
+    std::rotate(values.begin(), values.begin() + 1, values.end());
+    std::swap(values[size / 2], values[size / 2 + 1]);
+    OddEvenBubble<IT>(values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+
+    values = expected;
+    std::rotate(values.begin(), values.end() - 1, values.end());
+    OddEvenBubble<IT>(values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+  }
+}
@@ -21,7 +21,11 @@
 #include <comb.hxx>
 
 // STD includes
+#include <algorithm>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <random>
 #include <vector>
 #include <string>
 
@@ -131,3 +135,94 @@ TEST(TestSort, CombGreaterComparator)
       EXPECT_GE(*it, *(it + 1));
   }
 }
+
+// Comb gaps tests
+TEST(TestSort, CombGaps)
+{
+  // Gaps should strictly increase from 1, shrinking by about 1.3 and skipping 9 and 10 (rule of 11)
+  EXPECT_EQ(1, kCombGaps[0]);
+  for (int i = 1; i < kCombGapsSize; ++i)
+  {
+    EXPECT_LT(kCombGaps[i - 1], kCombGaps[i]);
+    EXPECT_LE(kCombGaps[i], (static_cast<std::int64_t>(kCombGaps[i - 1]) * 13 + 9) / 10);
+  }
+  EXPECT_EQ(kCombGaps + kCombGapsSize, std::find(kCombGaps, kCombGaps + kCombGapsSize, 9));
+  EXPECT_EQ(kCombGaps + kCombGapsSize, std::find(kCombGaps, kCombGaps + kCombGapsSize, 10));
+  EXPECT_NE(kCombGaps + kCombGapsSize, std::find(kCombGaps, kCombGaps + kCombGapsSize, 11));
+}
+
+// Large Comb-Sort tests - Scalar and vectorized passes should both lead to sorted sequences
+TEST(TestSort, CombLargeSequences)
+{
+  std::mt19937 generator(7);
+  for (int size = 2; size < 5000; size = size * 3 + 1)
+  {
+    // Integers with duplicates, in order and in inverse order
+    {
+      std::uniform_int_distribution<int> distribution(-size / 4, size / 4);
+      Container values(size);
+      for (auto& value : values)
+        value = distribution(generator);
+
+      Container expected = values;
+      std::sort(expected.begin(), expected.end());
+      Container sorted = values;
+      Comb<IT>(sorted.begin(), sorted.end());
+      EXPECT_EQ(expected, sorted);
+
+      std::reverse(expected.begin(), expected.end());
+      Comb<IT, std::greater_equal<int>>(values.begin(), values.end());
+      EXPECT_EQ(expected, values);
+    }
+
+    // Unsigned values
+    {
+      std::vector<std::uint32_t> values(size);
+      for (auto& value : values)
+        value = static_cast<std::uint32_t>(generator());
+
+      std::vector<std::uint32_t> expected = values;
+      std::sort(expected.begin(), expected.end());
+      Comb<std::vector<std::uint32_t>::iterator>(values.begin(), values.end());
+      EXPECT_EQ(expected, values);
+    }
+
+    // Double values in inverse order
+    {
+      std::uniform_real_distribution<double> distribution(-1., 1.);
+      std::vector<double> values(size);
+      for (auto& value : values)
+        value = distribution(generator);
+
+      std::vector<double> expected = values;
+      std::sort(expected.begin(), expected.end(), std::greater<double>());
+      Comb<std::vector<double>::iterator, std::greater<double>>(values.begin(), values.end());
+      EXPECT_EQ(expected, values);
+    }
+
+    // Non contiguous sequence - Scalar passes only
+    {
+      std::uniform_int_distribution<int> distribution(0, size);
+      std::deque<int> values(size);
+      for (auto& value : values)
+        value = distribution(generator);
+
+      std::deque<int> expected = values;
+      std::sort(expected.begin(), expected.end());
+      Comb<std::deque<int>::iterator>(values.begin(), values.end());
+      EXPECT_EQ(expected, values);
+    }
+  }
+
+  // Strings - Generic swaps
+  {
+    std::vector<std::string> values;
+    for (int i = 0; i < 500; ++i)
+      values.push_back(std::to_string((i * 7919) % 503));
+
+    std::vector<std::string> expected = values;
+    std::sort(expected.begin(), expected.end());
+    Comb<std::vector<std::string>::iterator>(values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+  }
+}
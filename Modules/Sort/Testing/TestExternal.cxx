@@ -0,0 +1,259 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <external.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Key / Payload record: only the key is compared, the payload tells equivalent keys apart
+  struct Record
+  {
+    std::uint64_t key;
+    std::uint32_t payload;
+  };
+  struct RecordLess
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.key < b.key; }
+  };
+
+  const std::string InputPath = "TestExternal_input.bin";
+  const std::string OutputPath = "TestExternal_output.bin";
+
+  std::vector<Record> BuildRecords(int size)
+  {
+    std::vector<Record> records;
+    for (int i = 0; i < size; ++i)
+    {
+      Record record = {static_cast<std::uint64_t>((i * 7919) % 1009), static_cast<std::uint32_t>(i)};
+      records.push_back(record);
+    }
+    return records;
+  }
+
+  template <typename T>
+  void WriteFile(const std::string& path, const std::vector<T>& values)
+  {
+    auto file = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(file != nullptr);
+    if (!values.empty())
+      std::fwrite(values.data(), sizeof(T), values.size(), file);
+    std::fclose(file);
+  }
+
+  template <typename T>
+  std::vector<T> ReadFile(const std::string& path)
+  {
+    std::vector<T> values;
+    auto file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+      return values;
+
+    T value;
+    while (std::fread(&value, sizeof(T), 1, file) == 1)
+      values.push_back(value);
+    std::fclose(file);
+    return values;
+  }
+
+  bool FileExists(const std::string& path)
+  {
+    auto file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+      return false;
+    std::fclose(file);
+    return true;
+  }
+
+  // Directories cannot be opened as files: used to make the sort fail on a given path
+  void MakeDirectory(const std::string& path)
+  {
+#if defined(_WIN32)
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0700);
+#endif
+  }
+
+  void RemoveDirectory(const std::string& path)
+  {
+#if defined(_WIN32)
+    _rmdir(path.c_str());
+#else
+    rmdir(path.c_str());
+#endif
+  }
+
+  // Expected output of a stable sort
+  void CheckStableOutput(const std::vector<Record>& records, const std::string& path)
+  {
+    std::vector<Record> expected(records);
+    std::stable_sort(expected.begin(), expected.end(), RecordLess());
+
+    const auto sorted = ReadFile<Record>(path);
+    ASSERT_EQ(expected.size(), sorted.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_EQ(expected[i].key, sorted[i].key);
+      EXPECT_EQ(expected[i].payload, sorted[i].payload);
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// External Sort tests
+TEST(TestExternal, ExternalSorts)
+{
+  const auto records = BuildRecords(10000);
+
+  // Small memory budget - Many runs merged in several passes, output should be stably sorted
+  {
+    WriteFile(InputPath, records);
+    ExternalSortOptions options;
+    options.memoryBudget = 48 * sizeof(Record);
+    options.bufferSize = 8 * sizeof(Record);
+    int progressCalls = 0;
+    options.progress = [&progressCalls](const ExternalSortCounters&) { ++progressCalls; };
+
+    ExternalSortCounters counters;
+    EXPECT_TRUE((ExternalSort<Record, RecordLess>(InputPath, OutputPath, options, &counters)));
+    CheckStableOutput(records, OutputPath);
+
+    // 32 records per run merged 5 by 5: input and each pass read and write the whole file once
+    EXPECT_EQ(10000u, counters.records);
+    EXPECT_EQ(10000u, counters.mergedRecords);
+    EXPECT_EQ(4, counters.mergePass);
+    EXPECT_EQ(313u + 63u + 13u + 3u, counters.runs);
+    EXPECT_EQ(5 * 10000 * sizeof(Record), counters.bytesRead);
+    EXPECT_EQ(5 * 10000 * sizeof(Record), counters.bytesWritten);
+    EXPECT_LT(0, progressCalls);
+
+    // Temporary runs are removed
+    EXPECT_FALSE(FileExists(OutputPath + ".run0"));
+    EXPECT_FALSE(FileExists(OutputPath + ".run400"));
+  }
+
+  // Unstable runs sorted in place, merged in a single pass - Keys should be sorted
+  {
+    WriteFile(InputPath, records);
+    ExternalSortOptions options;
+    options.memoryBudget = 1100 * sizeof(Record);
+    options.bufferSize = 100 * sizeof(Record);
+    options.isStable = false;
+    options.temporaryPrefix = "TestExternal_tmp_";
+
+    ExternalSortCounters counters;
+    EXPECT_TRUE((ExternalSort<Record, RecordLess>(InputPath, OutputPath, options, &counters)));
+    const auto sorted = ReadFile<Record>(OutputPath);
+    ASSERT_EQ(records.size(), sorted.size());
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), RecordLess()));
+    EXPECT_EQ(10u, counters.runs);
+    EXPECT_EQ(1, counters.mergePass);
+    EXPECT_FALSE(FileExists("TestExternal_tmp_0"));
+  }
+
+  // Whole input fitting the memory budget, sorted in place in inverse order - No run should be spilled
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i)
+      values.push_back((i * 7919) % 1009 - 500);
+    WriteFile(InputPath, values);
+
+    ExternalSortCounters counters;
+    EXPECT_TRUE((ExternalSort<int, std::greater<int>>(InputPath, InputPath, ExternalSortOptions(), &counters)));
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    EXPECT_EQ(values, ReadFile<int>(InputPath));
+    EXPECT_EQ(0u, counters.runs);
+    EXPECT_EQ(0, counters.mergePass);
+    EXPECT_EQ(1000 * sizeof(int), counters.bytesRead);
+    EXPECT_EQ(1000 * sizeof(int), counters.bytesWritten);
+  }
+
+  // Empty input - Output should be empty
+  {
+    WriteFile(InputPath, std::vector<int>());
+    EXPECT_TRUE(ExternalSort<int>(InputPath, OutputPath));
+    EXPECT_TRUE(FileExists(OutputPath));
+    EXPECT_TRUE(ReadFile<int>(OutputPath).empty());
+  }
+
+  // Missing input - Sort should fail
+  {
+    EXPECT_FALSE(ExternalSort<int>("TestExternal_missing.bin", OutputPath));
+  }
+
+  std::remove(InputPath.c_str());
+  std::remove(OutputPath.c_str());
+}
+
+// Failing final write of an in place sort - The input should be left untouched and temporary files removed
+TEST(TestExternal, ExternalSortFailures)
+{
+  const auto records = BuildRecords(1000);
+  const auto sortedPath = InputPath + ".run.out";
+
+  // Several runs: the final merge fails
+  {
+    MakeDirectory(sortedPath);
+    WriteFile(InputPath, records);
+    ExternalSortOptions options;
+    options.memoryBudget = 48 * sizeof(Record);
+    options.bufferSize = 8 * sizeof(Record);
+
+    EXPECT_FALSE((ExternalSort<Record, RecordLess>(InputPath, InputPath, options)));
+    const auto input = ReadFile<Record>(InputPath);
+    ASSERT_EQ(records.size(), input.size());
+    for (std::size_t i = 0; i < records.size(); ++i)
+      EXPECT_EQ(records[i].payload, input[i].payload);
+    EXPECT_FALSE(FileExists(InputPath + ".run0"));
+    RemoveDirectory(sortedPath);
+  }
+
+  // Single chunk: its write fails
+  {
+    MakeDirectory(sortedPath);
+    WriteFile(InputPath, records);
+    EXPECT_FALSE((ExternalSort<Record, RecordLess>(InputPath, InputPath)));
+    const auto input = ReadFile<Record>(InputPath);
+    ASSERT_EQ(records.size(), input.size());
+    for (std::size_t i = 0; i < records.size(); ++i)
+      EXPECT_EQ(records[i].payload, input[i].payload);
+  }
+
+  RemoveDirectory(sortedPath);
+  std::remove(InputPath.c_str());
+}
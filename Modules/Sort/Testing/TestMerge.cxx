@@ -21,7 +21,9 @@
 #include <merge.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -48,6 +50,24 @@ namespace {
   typedef std::vector<int> Container;
   typedef Container::iterator IT;
   typedef MergeWithBuffer<std::string::iterator> Aggregator_Str;
+
+  // Primary key / Secondary key / Payload record: the payload tells equivalent keys apart
+  struct Record
+  {
+    int primary;
+    int secondary;
+    int payload;
+  };
+  struct PrimaryLess
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.primary < b.primary; }
+  };
+  struct SecondaryGreater
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.secondary > b.secondary; }
+  };
+  typedef std::vector<Record> Records;
+  typedef Records::iterator RecordIT;
 }
 #endif /* DOXYGEN_SKIP */
 
@@ -253,3 +273,319 @@ TEST(TestMerge, MergeSorts)
       EXPECT_LE(*it, *(it + 1));
   }
 }
+
+// Basic MergeWithScratch tests
+TEST(TestMerge, MergeWithScratchs)
+{
+  Container scratch;
+
+  // Normal Run - All elements should be sorted in order
+  {
+    Container sortedArrayWithRot
+      (SortedArrayIntWithRot, SortedArrayIntWithRot + sizeof(SortedArrayIntWithRot) / sizeof(int));
+    MergeWithScratch<IT> aggregator(scratch);
+    aggregator(sortedArrayWithRot.begin(), sortedArrayWithRot.begin() + 4, sortedArrayWithRot.end());
+
+    // All elements of the final array are sorted
+    for (auto it = sortedArrayWithRot.begin(); it < sortedArrayWithRot.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+
+    // Scratch only grown to the first sequence size
+    EXPECT_EQ(4u, scratch.size());
+  }
+
+  // Fixed scratch range - All elements should be sorted in order
+  {
+    Container sortedArrayWithRot
+      (SortedArrayIntWithRot, SortedArrayIntWithRot + sizeof(SortedArrayIntWithRot) / sizeof(int));
+    Container fixedScratch(4);
+    MergeWithScratch<IT> aggregator(fixedScratch.begin());
+    aggregator(sortedArrayWithRot.begin(), sortedArrayWithRot.begin() + 4, sortedArrayWithRot.end());
+
+    for (auto it = sortedArrayWithRot.begin(); it < sortedArrayWithRot.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomArrayPos(RandomArrayIntPos, RandomArrayIntPos + sizeof(RandomArrayIntPos) / sizeof(int));
+    MergeWithScratch<IT> aggregator(scratch);
+    aggregator(randomArrayPos.end(), randomArrayPos.begin() + 3, randomArrayPos.begin());
+
+    int i = 0;
+    for (auto it = randomArrayPos.begin(); it < randomArrayPos.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayIntPos[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    MergeWithScratch<IT> aggregator(scratch);
+    aggregator(emptyArray.begin(), emptyArray.begin(), emptyArray.end());
+  }
+
+  // String Collection - All elements should be sorted in order
+  {
+    std::string stringToMerge = StringWithPivot;
+    std::vector<char> charScratch;
+    MergeWithScratch<std::string::iterator> aggregator(charScratch);
+    aggregator(stringToMerge.begin(), stringToMerge.begin() + 4, stringToMerge.end());
+
+    // All elements of the final array are sorted
+    for (auto it = stringToMerge.begin(); it < stringToMerge.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+}
+
+// Merge-Sort tests using a single scratch buffer
+TEST(TestMerge, MergeSortWithScratchs)
+{
+  // Normal Run - all elements should be sorter in order
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    MergeSortWithScratch<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    MergeSortWithScratch<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    MergeSortWithScratch<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // Caller scratch buffer - Should be sized once to N / 2 and reused without reallocation
+  {
+    Container scratch;
+    Container randomArray;
+    for (int i = 0; i < 10001; ++i)
+      randomArray.push_back((i * 7919) % 1009 - 500);
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    MergeSortWithScratch<IT>(randomArray.begin(), randomArray.end(), scratch);
+    EXPECT_EQ(expected, randomArray);
+    EXPECT_EQ(5000u, scratch.size());
+
+    const auto kScratchData = scratch.data();
+    std::reverse(randomArray.begin(), randomArray.end());
+    MergeSortWithScratch<IT>(randomArray.begin(), randomArray.end(), scratch);
+    EXPECT_EQ(expected, randomArray);
+    EXPECT_EQ(kScratchData, scratch.data());
+  }
+
+  // Move only elements - Should be sorted without any copy
+  {
+    std::vector<std::unique_ptr<int>> pointers;
+    for (int i = 0; i < 100; ++i)
+      pointers.push_back(std::unique_ptr<int>(new int((i * 37) % 100)));
+
+    typedef std::vector<std::unique_ptr<int>>::iterator PtrIT;
+    struct PtrLess
+    {
+      bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const { return *a < *b; }
+    };
+    MergeSortWithScratch<PtrIT, PtrLess>(pointers.begin(), pointers.end());
+    for (int i = 0; i < 100; ++i)
+      EXPECT_EQ(i, *pointers[i]);
+  }
+
+  // String collection - all elements should be sorter in inverse order
+  {
+    std::string randomStr = RandomStr;
+    MergeSortWithScratch<std::string::iterator, std::greater<char>>(randomStr.begin(), randomStr.end());
+
+    // All elements are sorted in inverse order
+    for (auto it = randomStr.begin(); it < randomStr.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Basic MergeWithRotations tests
+TEST(TestMerge, MergeWithRotations)
+{
+  // Normal Run - All elements should be sorted in order
+  {
+    Container sortedArrayWithRot
+      (SortedArrayIntWithRot, SortedArrayIntWithRot + sizeof(SortedArrayIntWithRot) / sizeof(int));
+    MergeWithRotations<IT>()
+      (sortedArrayWithRot.begin(), sortedArrayWithRot.begin() + 4, sortedArrayWithRot.end());
+
+    // All elements of the final array are sorted
+    for (auto it = sortedArrayWithRot.begin(); it < sortedArrayWithRot.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomArrayPos(RandomArrayIntPos, RandomArrayIntPos + sizeof(RandomArrayIntPos) / sizeof(int));
+    MergeWithRotations<IT>()(randomArrayPos.end(), randomArrayPos.begin() + 3, randomArrayPos.begin());
+
+    int i = 0;
+    for (auto it = randomArrayPos.begin(); it < randomArrayPos.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayIntPos[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    MergeWithRotations<IT>()(emptyArray.begin(), emptyArray.begin(), emptyArray.end());
+  }
+
+  // Double values array - Order should be made
+  {
+    Container doubleValues(1, 511);
+    doubleValues.push_back(66);
+
+    MergeWithRotations<IT>()(doubleValues.begin(), doubleValues.begin() + 1, doubleValues.end());
+
+    EXPECT_EQ(66, doubleValues[0]);
+    EXPECT_EQ(511, doubleValues[1]);
+  }
+
+  // Equivalent keys - Should keep their relative order
+  {
+    typedef std::pair<int, int> Record;
+    struct KeyLess
+    {
+      bool operator()(const Record& a, const Record& b) const { return a.first < b.first; }
+    };
+
+    std::vector<Record> records;
+    for (int i = 0; i < 300; ++i)
+      records.push_back(Record(i / 7, i));
+    for (int i = 0; i < 200; ++i)
+      records.push_back(Record(i / 3, 300 + i));
+    MergeWithRotations<std::vector<Record>::iterator, KeyLess>()
+      (records.begin(), records.begin() + 300, records.end());
+
+    for (auto it = records.begin(); it < records.end() - 1; ++it)
+      EXPECT_TRUE(it->first < (it + 1)->first || (it->first == (it + 1)->first && it->second < (it + 1)->second));
+  }
+
+  // String Collection - All elements should be sorted in order
+  {
+    std::string str = StringWithPivot;
+    MergeWithRotations<std::string::iterator>()(str.begin(), str.begin() + 4, str.end());
+
+    // All elements of the final array are sorted
+    for (auto it = str.begin(); it < str.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+}
+
+// Merge-Sort tests using the rotation based in-place merge
+TEST(TestMerge, MergeSortWithRotations)
+{
+  Container randomArray;
+  for (int i = 0; i < 10000; ++i)
+    randomArray.push_back((i * 7919) % 1009 - 500);
+  Container expected(randomArray);
+  std::sort(expected.begin(), expected.end());
+
+  MergeSort<IT, MergeWithRotations<IT>>(randomArray.begin(), randomArray.end());
+  EXPECT_EQ(expected, randomArray);
+}
+
+// Basic StableSort tests
+TEST(TestMerge, StableSorts)
+{
+  // Normal Run - all elements should be sorter in order
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    StableSort<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    StableSort<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    StableSort<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // Key / Payload records of several sizes - Equivalent keys should keep their input order
+  for (int size = 1; size < 1000; size = size * 3 + 1)
+  {
+    Records records;
+    for (int i = 0; i < size; ++i)
+    {
+      Record record = {(i * 7919) % 13, 0, i};
+      records.push_back(record);
+    }
+
+    Records expected(records);
+    std::stable_sort(expected.begin(), expected.end(), PrimaryLess());
+    StableSort<RecordIT, PrimaryLess>(records.begin(), records.end());
+    for (int i = 0; i < size; ++i)
+      EXPECT_EQ(expected[i].payload, records[i].payload);
+  }
+
+  // Sort by the secondary key then by the primary one - Records should be ordered by both keys
+  {
+    Records records;
+    for (int i = 0; i < 500; ++i)
+    {
+      Record record = {(i * 7919) % 7, (i * 104729) % 11, i};
+      records.push_back(record);
+    }
+
+    std::vector<Record> scratch;
+    StableSort<RecordIT, SecondaryGreater>(records.begin(), records.end(), scratch);
+    StableSort<RecordIT, PrimaryLess>(records.begin(), records.end(), scratch);
+    for (auto it = records.begin(); it < records.end() - 1; ++it)
+    {
+      const auto& next = *(it + 1);
+      EXPECT_TRUE(it->primary < next.primary || (it->primary == next.primary &&
+                  (it->secondary > next.secondary || (it->secondary == next.secondary && it->payload < next.payload))));
+    }
+  }
+
+  // Caller-owned scratch range of N / 2 elements - Equivalent records should keep their order
+  {
+    Records records;
+    for (int i = 0; i < 333; ++i)
+    {
+      Record record = {(i * 7919) % 13, 0, i};
+      records.push_back(record);
+    }
+
+    Records expected(records);
+    std::stable_sort(expected.begin(), expected.end(), PrimaryLess());
+    Records scratch(records.size() / 2);
+    StableSort<RecordIT, PrimaryLess>(records.begin(), records.end(), scratch.begin());
+    for (size_t i = 0; i < records.size(); ++i)
+      EXPECT_EQ(expected[i].payload, records[i].payload);
+  }
+
+  // String collection - all elements should be sorter in inverse order
+  {
+    std::string randomStr = RandomStr;
+    StableSort<std::string::iterator, std::greater<char>>(randomStr.begin(), randomStr.end());
+    EXPECT_EQ("zxvgeeca", randomStr);
+  }
+}
@@ -0,0 +1,240 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <merge_k.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef Container::const_iterator CIT;
+
+  // Key / Origin pairs: only the key is compared, the origin tells equivalent keys apart
+  typedef std::pair<int, int> Element;
+  typedef std::vector<Element>::iterator EIT;
+  struct ElementLess
+  {
+    bool operator()(const Element& a, const Element& b) const { return a.first < b.first; }
+  };
+
+  Container BuildRandom(int size)
+  {
+    Container values;
+    for (int i = 0; i < size; ++i)
+      values.push_back(static_cast<int>((static_cast<unsigned>(i) * 2654435761u) % 1000) - 500);
+    return values;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Loser Tree tests
+TEST(TestMergeK, LoserTrees)
+{
+  // Five sequences with duplicates - Heads should come out in order, ties by sequence index
+  {
+    const int sequences[5][3] = {{1, 4, 9}, {2, 4, 8}, {0, 5, 5}, {3, 3, 10}, {1, 6, 7}};
+    int positions[5] = {0, 0, 0, 0, 0};
+    LoserTree<int> tree(5);
+    for (int i = 0; i < 5; ++i)
+      tree.Set(i, sequences[i][0]);
+    tree.Build();
+
+    std::vector<std::pair<int, std::size_t>> output;
+    while (!tree.IsEmpty())
+    {
+      const auto source = tree.Winner();
+      output.push_back(std::make_pair(tree.Top(), source));
+      if (++positions[source] < 3)
+        tree.Replace(sequences[source][positions[source]]);
+      else
+        tree.Exhaust();
+    }
+
+    ASSERT_EQ(15u, output.size());
+    for (std::size_t i = 1; i < output.size(); ++i)
+      EXPECT_FALSE(output[i] < output[i - 1]);
+    EXPECT_EQ(std::make_pair(1, std::size_t(0)), output[1]);
+    EXPECT_EQ(std::make_pair(1, std::size_t(4)), output[2]);
+  }
+
+  // No sequence or only empty sequences - Tree should be empty
+  {
+    LoserTree<int> emptyTree(0);
+    emptyTree.Build();
+    EXPECT_TRUE(emptyTree.IsEmpty());
+
+    LoserTree<int> exhaustedTree(3);
+    exhaustedTree.Build();
+    EXPECT_TRUE(exhaustedTree.IsEmpty());
+  }
+}
+
+// MergeK tests
+TEST(TestMergeK, MergeKs)
+{
+  // Sorted shards of different sizes, some empty - Should be merged in order
+  {
+    std::vector<Container> shards(6);
+    const auto values = BuildRandom(1000);
+    for (std::size_t i = 0; i < values.size(); ++i)
+      if (i % 7 != 3)
+        shards[(i * i) % 5].push_back(values[i]);
+    std::vector<std::pair<CIT, CIT>> ranges;
+    for (auto& shard : shards)
+    {
+      std::sort(shard.begin(), shard.end());
+      ranges.push_back(std::make_pair(shard.cbegin(), shard.cend()));
+    }
+
+    Container merged;
+    MergeK<CIT>(ranges, std::back_inserter(merged));
+    Container expected;
+    for (auto& shard : shards)
+      expected.insert(expected.end(), shard.begin(), shard.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, merged);
+  }
+
+  // Equivalent keys in all the ranges - Elements of the first ranges should come first
+  {
+    std::vector<std::vector<Element>> shards(3);
+    for (int i = 0; i < 30; ++i)
+      shards[i % 3].push_back(std::make_pair(i / 9, i % 3));
+    std::vector<std::pair<EIT, EIT>> ranges;
+    for (auto& shard : shards)
+      ranges.push_back(std::make_pair(shard.begin(), shard.end()));
+
+    std::vector<Element> merged(30);
+    EXPECT_EQ(merged.end(), (MergeK<EIT, ElementLess>(ranges, merged.begin())));
+    for (std::size_t i = 1; i < merged.size(); ++i)
+      EXPECT_FALSE(merged[i] < merged[i - 1]);
+  }
+
+  // Inverse order with a reused loser tree - Should be merged in inverse order
+  {
+    Container first = {9, 7, 7, 2};
+    Container second = {8, 7, 1, 0};
+    std::vector<std::pair<IT, IT>> ranges;
+    ranges.push_back(std::make_pair(first.begin(), first.end()));
+    ranges.push_back(std::make_pair(second.begin(), second.end()));
+
+    LoserTree<int, std::greater<int>> tree;
+    for (int i = 0; i < 2; ++i)
+    {
+      Container merged;
+      MergeK<IT, std::greater<int>>(ranges, std::back_inserter(merged), tree);
+      EXPECT_EQ(Container({9, 8, 7, 7, 7, 2, 1, 0}), merged);
+    }
+  }
+
+  // No range or only empty ranges - Output should be untouched
+  {
+    Container empty;
+    Container merged;
+    EXPECT_EQ(merged.begin(), MergeK<IT>(std::vector<std::pair<IT, IT>>(), merged.begin()));
+    std::vector<std::pair<IT, IT>> ranges(3, std::make_pair(empty.begin(), empty.end()));
+    MergeK<IT>(ranges, std::back_inserter(merged));
+    EXPECT_TRUE(merged.empty());
+  }
+}
+
+// MergeKWithBuffer tests
+TEST(TestMergeK, MergeKWithBuffers)
+{
+  // Consecutive sorted sequences, one empty - Should be merged in place
+  {
+    Container values = {1, 5, 9, 2, 3, 4, 0, 10};
+    const auto begin = values.begin();
+    MergeKWithBuffer<IT> aggregator;
+    aggregator(std::vector<IT>({begin, begin + 3, begin + 3, begin + 6, begin + 8}));
+    EXPECT_EQ(Container({0, 1, 2, 3, 4, 5, 9, 10}), values);
+  }
+
+  // Sequences already in order, one empty - Array should be unaffected
+  {
+    Container values = {1, 2, 2, 3};
+    const auto begin = values.begin();
+    MergeKWithBuffer<IT> aggregator;
+    aggregator(std::vector<IT>({begin, begin + 2, begin + 2, begin + 4}));
+    EXPECT_EQ(Container({1, 2, 2, 3}), values);
+  }
+}
+
+// MultiwayMergeSort tests
+TEST(TestMergeK, MultiwayMergeSorts)
+{
+  // Random sequences of several sizes and fan-ins - Should be sorted
+  for (int ways = 2; ways <= 16; ways *= 2)
+  {
+    for (int size = 0; size < 300; size += 37)
+    {
+      auto values = BuildRandom(size);
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+      MultiwayMergeSort<IT>(values.begin(), values.end(), ways);
+      EXPECT_EQ(expected, values);
+    }
+  }
+
+  // Equivalent keys - Sort should be stable
+  {
+    std::vector<Element> elements;
+    const auto keys = BuildRandom(500);
+    for (int i = 0; i < 500; ++i)
+      elements.push_back(std::make_pair(keys[i] % 10, i));
+    auto expected = elements;
+    std::stable_sort(expected.begin(), expected.end(), ElementLess());
+    MultiwayMergeSort<EIT, ElementLess>(elements.begin(), elements.end(), 5);
+    EXPECT_EQ(expected, elements);
+  }
+
+  // Strings in inverse order with a shared aggregator - Should be sorted in inverse order
+  {
+    std::vector<std::string> words;
+    for (int value : BuildRandom(100))
+      words.push_back(std::to_string(value));
+    auto expected = words;
+    std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+
+    typedef std::vector<std::string>::iterator SIT;
+    MergeKWithBuffer<SIT, std::greater<std::string>> aggregator(3);
+    EXPECT_EQ(3, aggregator.Ways());
+    MultiwayMergeSort<SIT>(words.begin(), words.end(), aggregator);
+    EXPECT_EQ(expected, words);
+  }
+
+  // Inverse iterator order - Array should be unaffected
+  {
+    Container values = {4, 3, 2, 1};
+    MultiwayMergeSort<IT>(values.end(), values.begin());
+    EXPECT_EQ(Container({4, 3, 2, 1}), values);
+  }
+}
@@ -0,0 +1,262 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <merge.hxx>
+#include <natural_merge.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Simple sorted array of integers with negative values
+  const int SortedArrayIntWithRot[] = {-3, 2, 7, 20, 0, 2, 8, 15, 36};
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Key / Payload record: only the key is compared, the payload tells equivalent keys apart
+  typedef std::pair<int, int> Record;
+  typedef std::vector<Record> Records;
+  typedef Records::iterator RecordIT;
+  struct KeyLess
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.first < b.first; }
+  };
+
+  // Comparator counting its calls
+  int ComparisonCount = 0;
+  struct CountingLess
+  {
+    bool operator()(int a, int b) const { ++ComparisonCount; return a < b; }
+  };
+
+  // Check stability: equivalent keys keep the payload (original index) order
+  void CheckStableSorted(const Records& records)
+  {
+    for (auto it = records.begin(); it < records.end() - 1; ++it)
+    {
+      EXPECT_LE(it->first, (it + 1)->first);
+      if (it->first == (it + 1)->first)
+      {
+        EXPECT_LT(it->second, (it + 1)->second);
+      }
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Gallop bounds tests - Should match std::lower_bound / std::upper_bound
+TEST(TestNaturalMerge, GallopBounds)
+{
+  Container values;
+  for (int i = 0; i < 100; ++i)
+    values.push_back(i / 3);
+
+  for (int key = -1; key < 35; ++key)
+  {
+    EXPECT_EQ(std::lower_bound(values.begin(), values.end(), key),
+              GallopLowerBound<IT>(values.begin(), values.end(), key));
+    EXPECT_EQ(std::upper_bound(values.begin(), values.end(), key),
+              GallopUpperBound<IT>(values.begin(), values.end(), key));
+  }
+
+  // Empty sequence - Should return end
+  Container emptyArray;
+  EXPECT_EQ(emptyArray.end(), GallopLowerBound<IT>(emptyArray.begin(), emptyArray.end(), 0));
+  EXPECT_EQ(emptyArray.end(), GallopUpperBound<IT>(emptyArray.begin(), emptyArray.end(), 0));
+}
+
+// Basic MergeWithGallop tests
+TEST(TestNaturalMerge, MergeWithGallops)
+{
+  // Normal Run - All elements should be sorted in order
+  {
+    Container sortedArrayWithRot
+      (SortedArrayIntWithRot, SortedArrayIntWithRot + sizeof(SortedArrayIntWithRot) / sizeof(int));
+    MergeWithGallop<IT> aggregator;
+    aggregator(sortedArrayWithRot.begin(), sortedArrayWithRot.begin() + 4, sortedArrayWithRot.end());
+
+    // All elements of the final array are sorted
+    for (auto it = sortedArrayWithRot.begin(); it < sortedArrayWithRot.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Long interleaved blocks going through the galloping mode - Should be stable
+  {
+    Records records;
+    for (int i = 0; i < 1000; ++i)
+      records.push_back(Record((i / 50) * 2, i));
+    for (int i = 0; i < 1000; ++i)
+      records.push_back(Record((i / 25) + 1, 1000 + i));
+
+    MergeWithGallop<RecordIT, KeyLess> aggregator;
+    aggregator(records.begin(), records.begin() + 1000, records.end());
+    CheckStableSorted(records);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    MergeWithGallop<IT> aggregator;
+    aggregator(emptyArray.begin(), emptyArray.begin(), emptyArray.end());
+  }
+}
+
+// Basic Natural Merge-Sort tests
+TEST(TestNaturalMerge, NaturalMergeSorts)
+{
+  // Normal Run - all elements should be sorter in order
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    NaturalMergeSort<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Already sortedArray - Array should not be affected
+  {
+    Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    NaturalMergeSort<IT>(sortedArray.begin(), sortedArray.end());
+
+    int i = 0;
+    for (auto it = sortedArray.begin(); it < sortedArray.end(); ++it, ++i)
+      EXPECT_EQ(SortedArrayInt[i], *it);
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    NaturalMergeSort<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    NaturalMergeSort<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // Random records - Should be sorted and stable
+  {
+    Records records;
+    for (int i = 0; i < 10000; ++i)
+      records.push_back(Record((i * 7919) % 101, i));
+    NaturalMergeSort<RecordIT, KeyLess>(records.begin(), records.end());
+    CheckStableSorted(records);
+  }
+
+  // Ascending and descending runs with duplicates - Should be sorted and stable
+  {
+    Records records;
+    for (int i = 0; i < 5000; ++i)
+      records.push_back(Record((i % 700 < 350) ? i % 700 : 700 - i % 700, i));
+    NaturalMergeSort<RecordIT, KeyLess>(records.begin(), records.end());
+    CheckStableSorted(records);
+  }
+
+  // Other aggregator hooks - Should be sorted
+  {
+    Container randomArray;
+    for (int i = 0; i < 5000; ++i)
+      randomArray.push_back((i * 7919) % 1009);
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    Container bufferArray(randomArray);
+    NaturalMergeSort<IT, std::less<int>, MergeWithBuffer<IT>>(bufferArray.begin(), bufferArray.end());
+    EXPECT_EQ(expected, bufferArray);
+
+    Container scratch;
+    MergeWithScratch<IT> aggregator(scratch);
+    NaturalMergeSort<IT, std::less<int>, MergeWithScratch<IT>>(randomArray.begin(), randomArray.end(), aggregator);
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // String collection - all elements should be sorter in inverse order
+  {
+    std::string randomStr = RandomStr;
+    NaturalMergeSort<std::string::iterator, std::greater<char>>(randomStr.begin(), randomStr.end());
+
+    // All elements are sorted in inverse order
+    for (auto it = randomStr.begin(); it < randomStr.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Natural Merge-Sort on nearly sorted sequences - Should take a linear number of comparisons
+TEST(TestNaturalMerge, NaturalMergeSortAdaptivity)
+{
+  const int kSize = 100000;
+
+  // Already sorted - Single run detected
+  {
+    Container sortedArray;
+    for (int i = 0; i < kSize; ++i)
+      sortedArray.push_back(i);
+
+    ComparisonCount = 0;
+    NaturalMergeSort<IT, CountingLess>(sortedArray.begin(), sortedArray.end());
+    EXPECT_EQ(kSize - 1, ComparisonCount);
+  }
+
+  // Inverse sorted - Single run reversed
+  {
+    Container invSortedArray;
+    for (int i = 0; i < kSize; ++i)
+      invSortedArray.push_back(kSize - i);
+
+    ComparisonCount = 0;
+    NaturalMergeSort<IT, CountingLess>(invSortedArray.begin(), invSortedArray.end());
+    EXPECT_EQ(kSize - 1, ComparisonCount);
+    EXPECT_TRUE(std::is_sorted(invSortedArray.begin(), invSortedArray.end()));
+  }
+
+  // Sorted log with appended values - Few comparisons per element
+  {
+    Container appendedArray;
+    for (int i = 0; i < kSize; ++i)
+      appendedArray.push_back(i * 2);
+    for (int i = 0; i < 100; ++i)
+      appendedArray.push_back((i * 7919) % (2 * kSize));
+
+    ComparisonCount = 0;
+    NaturalMergeSort<IT, CountingLess>(appendedArray.begin(), appendedArray.end());
+    EXPECT_GT(2 * kSize, ComparisonCount);
+    EXPECT_TRUE(std::is_sorted(appendedArray.begin(), appendedArray.end()));
+  }
+}
@@ -0,0 +1,317 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <parallel.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Key / Payload record: only the key is compared, the payload tells equivalent keys apart
+  struct Record
+  {
+    int key;
+    int payload;
+    bool operator==(const Record& other) const { return key == other.key && payload == other.payload; }
+  };
+  struct RecordLessEqual
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.key <= b.key; }
+  };
+  struct RecordLess
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.key < b.key; }
+  };
+  typedef std::vector<Record> Records;
+  typedef Records::iterator RecordIT;
+
+  Records BuildRecords(int size)
+  {
+    Records records;
+    for (int i = 0; i < size; ++i)
+    {
+      Record record = {(i * 7919) % 1009, i};
+      records.push_back(record);
+    }
+    return records;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// The calling thread counts as one of the threads running a sort
+TEST(TestParallel, ParallelSortWorkerCounts)
+{
+  EXPECT_EQ(1u, ParallelSortWorkerCount(0));
+  EXPECT_EQ(1u, ParallelSortWorkerCount(1));
+  EXPECT_EQ(1u, ParallelSortWorkerCount(2));
+  EXPECT_EQ(7u, ParallelSortWorkerCount(8));
+}
+
+// Parallel Quick-Sort tests
+TEST(TestParallel, ParallelQuickSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelQuickSort<IT>(randomdArray.begin(), randomdArray.end(), 2);
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelQuickSort<IT>(randomdArray.end(), randomdArray.begin(), 2);
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    ParallelQuickSort<IT>(emptyArray.begin(), emptyArray.end(), 2);
+  }
+
+  // Records - Result should be identical to the sequential one, whatever the pool and the grain size
+  {
+    Records expected = BuildRecords(100000);
+    QuickSort<RecordIT, RecordLessEqual>(expected.begin(), expected.end());
+
+    for (unsigned int threadCount = 0; threadCount < 4; ++threadCount)
+    {
+      ThreadPool pool(threadCount);
+      for (int grainSize = 16; grainSize <= 4096; grainSize *= 16)
+      {
+        Records records = BuildRecords(100000);
+        ParallelQuickSort<RecordIT, RecordLessEqual>(records.begin(), records.end(), pool, grainSize);
+        EXPECT_TRUE(expected == records);
+      }
+    }
+  }
+
+  // String - String should be sorted in inverse order
+  {
+    std::string stringToSort = RandomStr;
+    ParallelQuickSort<std::string::iterator, std::greater_equal<char>>(stringToSort.begin(), stringToSort.end());
+
+    // All elements are sorted in inverse order
+    for (auto it = stringToSort.begin(); it < stringToSort.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Parallel Merge-Sort tests
+TEST(TestParallel, ParallelMergeSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelMergeSort<IT>(randomdArray.begin(), randomdArray.end(), 2);
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelMergeSort<IT>(randomdArray.end(), randomdArray.begin(), 2);
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // Records - Result should be identical to the sequential one, whatever the pool and the grain size
+  {
+    typedef MergeWithBuffer<RecordIT, RecordLess> Aggregator;
+    Records expected = BuildRecords(20000);
+    MergeSort<RecordIT, Aggregator>(expected.begin(), expected.end());
+
+    for (unsigned int threadCount = 0; threadCount < 4; ++threadCount)
+    {
+      ThreadPool pool(threadCount);
+      for (int grainSize = 16; grainSize <= 4096; grainSize *= 16)
+      {
+        Records records = BuildRecords(20000);
+        ParallelMergeSort<RecordIT, Aggregator>(records.begin(), records.end(), pool, grainSize);
+        EXPECT_TRUE(expected == records);
+      }
+    }
+  }
+}
+
+// Parallel Stable Sort tests
+TEST(TestParallel, ParallelStableSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelStableSort<IT>(randomdArray.begin(), randomdArray.end(), 2);
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelStableSort<IT>(randomdArray.end(), randomdArray.begin(), 2);
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // Records - Equivalent keys should keep their input order, whatever the pool and the grain size
+  {
+    Records expected = BuildRecords(20000);
+    std::stable_sort(expected.begin(), expected.end(), RecordLess());
+
+    for (unsigned int threadCount = 0; threadCount < 4; ++threadCount)
+    {
+      ThreadPool pool(threadCount);
+      for (int grainSize = 16; grainSize <= 4096; grainSize *= 16)
+      {
+        Records records = BuildRecords(20000);
+        ParallelStableSort<RecordIT, RecordLess>(records.begin(), records.end(), pool, grainSize);
+        EXPECT_TRUE(expected == records);
+      }
+    }
+  }
+
+  // String collection - all elements should be sorter in inverse order
+  {
+    std::string randomStr = RandomStr;
+    ParallelStableSort<std::string::iterator, std::greater<char>>(randomStr.begin(), randomStr.end(), 2, 2);
+    EXPECT_EQ("zxvgeeca", randomStr);
+  }
+}
+
+// Parallel American Flag Sort tests
+TEST(TestParallel, ParallelAmericanFlagSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelAmericanFlagSort<IT>(randomdArray.begin(), randomdArray.end(), 2);
+
+    // All elements are sorted
+    for (IT it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container invArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelAmericanFlagSort<IT>(invArray.end(), invArray.begin(), 2);
+
+    int i = 0;
+    for (IT it = invArray.begin(); it < invArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // Large integer and string sequences with various grain sizes - Same result as the sequential sort
+  {
+    ThreadPool pool(3);
+    for (int grainSize = 16; grainSize <= 1 << 12; grainSize <<= 4)
+    {
+      Container randomArray;
+      std::vector<std::string> randomStrings;
+      for (int i = 0; i < 50000; ++i)
+      {
+        randomArray.push_back((i * 7919) % 50021 - 25000);
+        randomStrings.push_back(std::string(i % 5, 'p') + std::to_string((i * 7919) % 10007));
+      }
+      Container expected(randomArray);
+      AmericanFlagSort<IT>(expected.begin(), expected.end());
+      std::vector<std::string> expectedStrings(randomStrings);
+      AmericanFlagSort<std::vector<std::string>::iterator>(expectedStrings.begin(), expectedStrings.end());
+
+      ParallelAmericanFlagSort<IT>(randomArray.begin(), randomArray.end(), pool, grainSize);
+      EXPECT_EQ(expected, randomArray);
+      ParallelAmericanFlagSort<std::vector<std::string>::iterator>(randomStrings.begin(), randomStrings.end(),
+                                                                   pool, grainSize);
+      EXPECT_EQ(expectedStrings, randomStrings);
+    }
+  }
+}
+
+// Parallel odd-even transposition sort tests
+TEST(TestParallel, ParallelOddEvenBubbles)
+{
+  // Small sequences - Sorted sequentially
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelOddEvenBubble<IT>(randomdArray.begin(), randomdArray.end(), 4);
+    EXPECT_TRUE(std::is_sorted(randomdArray.begin(), randomdArray.end()));
+
+    Container emptyArray;
+    ParallelOddEvenBubble<IT>(emptyArray.begin(), emptyArray.end(), 4);
+  }
+
+  // Slices of a few elements - Passes split across threads, odd slice boundaries included
+  std::mt19937 generator(5);
+  for (int size = 64; size < 1200; size = size * 2 + 3)
+    for (unsigned int threadCount = 2; threadCount <= 4; ++threadCount)
+    {
+      Container values(size);
+      for (auto& value : values)
+        value = static_cast<int>(generator() % 1000);
+      Container expected = values;
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+      ParallelOddEvenBubble<IT, std::greater<int>>(values.begin(), values.end(), threadCount, 7);
+      EXPECT_EQ(expected, values);
+    }
+
+  // Nearly sorted sequence - Early exit once no slice swaps anymore
+  {
+    Container values(5000);
+    for (int i = 0; i < 5000; ++i)
+      values[i] = i;
+    std::swap(values[10], values[11]);
+    std::swap(values[2500], values[2502]);
+    ParallelOddEvenBubble<IT>(values.begin(), values.end(), 4, 100);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  }
+}
@@ -0,0 +1,198 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <partial.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Random, sorted, reversed, organ pipe and few distinct values sequences
+  std::vector<Container> BuildSequences(int size)
+  {
+    std::vector<Container> sequences(5);
+    for (int i = 0; i < size; ++i)
+    {
+      sequences[0].push_back(static_cast<int>((static_cast<unsigned>(i) * 2654435761u) % 100003));
+      sequences[1].push_back(i);
+      sequences[2].push_back(size - i);
+      sequences[3].push_back(i < size / 2 ? i : size - i);
+      sequences[4].push_back(i % 3);
+    }
+    return sequences;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Median Of Medians tests
+TEST(TestPartial, MedianOfMedians)
+{
+  // Median of medians should split the sequence into at least 30% / 30%
+  for (int size = 1; size < 1000; size = size * 2 + 1)
+  {
+    Container sequence = BuildSequences(size)[0];
+    const auto median = MedianOfMedians<IT>(sequence.begin(), sequence.end());
+    ASSERT_TRUE(median != sequence.end());
+
+    const auto lower = std::count_if(sequence.begin(), sequence.end(), [&median](int value) { return value < *median; });
+    const auto greater = std::count_if(sequence.begin(), sequence.end(), [&median](int value) { return value > *median; });
+    EXPECT_GE(lower, 3 * size / 10 - 2);
+    EXPECT_GE(greater, 3 * size / 10 - 2);
+  }
+
+  // Empty sequence - Should return end
+  {
+    Container emptyArray;
+    EXPECT_TRUE(MedianOfMedians<IT>(emptyArray.begin(), emptyArray.end()) == emptyArray.end());
+  }
+}
+
+// NthElement tests
+TEST(TestPartial, NthElements)
+{
+  // All kind of sequences and positions - Nth element should be in place and elements partitioned around it
+  for (int size = 1; size < 3000; size = size * 3 + 1)
+  {
+    for (const auto& input : BuildSequences(size))
+    {
+      Container expected(input);
+      std::sort(expected.begin(), expected.end());
+      for (int n = 0; n < size; n += 1 + size / 7)
+      {
+        Container sequence(input);
+        const auto nth = sequence.begin() + n;
+        NthElement<IT>(sequence.begin(), nth, sequence.end());
+        EXPECT_EQ(expected[n], *nth);
+        EXPECT_TRUE(std::all_of(sequence.begin(), nth, [&nth](int value) { return value <= *nth; }));
+        EXPECT_TRUE(std::all_of(nth, sequence.end(), [&nth](int value) { return value >= *nth; }));
+      }
+    }
+  }
+
+  // Median of medians pivots from the start - Selection should be identical
+  for (const auto& input : BuildSequences(2000))
+  {
+    Container expected(input);
+    std::sort(expected.begin(), expected.end());
+    for (int n = 0; n < 2000; n += 333)
+    {
+      Container sequence(input);
+      NthElementLoop<IT, std::less<int>>(sequence.begin(), sequence.begin() + n, sequence.end(), 0);
+      EXPECT_EQ(expected[n], sequence[n]);
+    }
+  }
+
+  // Inverse order - Nth biggest element should be in place
+  {
+    Container sequence(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    NthElement<IT, std::greater<int>>(sequence.begin(), sequence.begin() + 2, sequence.end());
+    EXPECT_EQ(4, sequence[2]);
+  }
+
+  // Nth outside the sequence or inverse iterator order - Array should not be affected
+  {
+    Container sequence(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    NthElement<IT>(sequence.begin(), sequence.end(), sequence.end());
+    NthElement<IT>(sequence.end(), sequence.begin() + 2, sequence.begin());
+    EXPECT_TRUE(std::equal(sequence.begin(), sequence.end(), RandomArrayInt));
+  }
+}
+
+// PartialHeapSort tests
+TEST(TestPartial, PartialHeapSorts)
+{
+  // All kind of sequences and sizes - First elements should be the sorted smallest ones
+  for (const auto& input : BuildSequences(1000))
+  {
+    Container expected(input);
+    std::sort(expected.begin(), expected.end());
+    for (int k = 0; k <= 1000; k += 111)
+    {
+      Container sequence(input);
+      PartialHeapSort<IT>(sequence.begin(), sequence.begin() + k, sequence.end());
+      EXPECT_TRUE(std::equal(sequence.begin(), sequence.begin() + k, expected.begin()));
+      std::sort(sequence.begin() + k, sequence.end());
+      EXPECT_TRUE(std::equal(sequence.begin() + k, sequence.end(), expected.begin() + k));
+    }
+  }
+
+  // Top-k much smaller than the sequence (heap selection within PartialSort) - Should be sorted in inverse order
+  {
+    Container sequence = BuildSequences(100000)[0];
+    Container expected(sequence);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    PartialSort<IT, std::greater<int>>(sequence.begin(), sequence.begin() + 100, sequence.end());
+    EXPECT_TRUE(std::equal(sequence.begin(), sequence.begin() + 100, expected.begin()));
+  }
+}
+
+// PartialSort tests
+TEST(TestPartial, PartialSorts)
+{
+  // All kind of sequences and sizes - First elements should be the sorted smallest ones
+  for (int size = 1; size < 3000; size = size * 3 + 1)
+  {
+    for (const auto& input : BuildSequences(size))
+    {
+      Container expected(input);
+      std::sort(expected.begin(), expected.end());
+      for (int k = 0; k <= size; k += 1 + size / 5)
+      {
+        Container sequence(input);
+        PartialSort<IT>(sequence.begin(), sequence.begin() + k, sequence.end());
+        EXPECT_TRUE(std::equal(sequence.begin(), sequence.begin() + k, expected.begin()));
+
+        // Remaining elements are kept
+        std::sort(sequence.begin() + k, sequence.end());
+        EXPECT_TRUE(std::equal(sequence.begin() + k, sequence.end(), expected.begin() + k));
+      }
+    }
+  }
+
+  // String collection - Three biggest characters should be sorted in inverse order
+  {
+    std::string randomStr = RandomStr;
+    PartialSort<std::string::iterator, std::greater<char>>(randomStr.begin(), randomStr.begin() + 3,
+                                                           randomStr.end());
+    EXPECT_EQ("zxv", randomStr.substr(0, 3));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container sequence(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    PartialSort<IT>(sequence.end(), sequence.begin() + 2, sequence.begin());
+    EXPECT_TRUE(std::equal(sequence.begin(), sequence.end(), RandomArrayInt));
+  }
+}
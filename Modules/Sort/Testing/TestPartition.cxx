@@ -21,6 +21,9 @@
 #include <partition.hxx>
 
 // STD includes
+#include <algorithm>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <vector>
 #include <string>
@@ -66,6 +69,35 @@ namespace {
       for (auto it = newPivot; it < end; ++it)
         EXPECT_GE(pivotVal, *it);
   }
+
+  // Partition sequences of various sizes with a standard functor - Elements should be partitioned and kept
+  template <typename T, typename Compare>
+  void CheckStandardPartition(const T firstValue, const T step)
+  {
+    typedef typename std::vector<T>::iterator TIT;
+    for (int size = 1; size < 1000; size = size * 3 / 2 + 1)
+    {
+      for (int pivotIdx = 0; pivotIdx < size; pivotIdx += size / 3 + 1)
+      {
+        std::vector<T> values;
+        for (int i = 0; i < size; ++i)
+          values.push_back(static_cast<T>(firstValue + step * static_cast<T>((i * 7919) % 257)));
+        std::vector<T> expected(values);
+        const auto pivotVal = values[pivotIdx];
+
+        auto newPivot = Partition<TIT, Compare>(values.begin(), values.begin() + pivotIdx, values.end());
+        EXPECT_EQ(pivotVal, *newPivot);
+        for (auto it = values.begin(); it < newPivot; ++it)
+          EXPECT_TRUE(Compare()(*it, pivotVal));
+        for (auto it = newPivot + 1; it < values.end(); ++it)
+          EXPECT_FALSE(Compare()(*it, pivotVal));
+
+        std::sort(values.begin(), values.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(expected, values);
+      }
+    }
+  }
 }
 #endif /* DOXYGEN_SKIP */
 
@@ -196,3 +228,142 @@ TEST(TestPartition, PartitionGreaterComparator)
     CheckPartition<std::string::iterator>(randomStr.begin(), randomStr.end(), newPivot, pivotVal, false);
   }
 }
+
+// Three-Way Partition tests - Should result in: [begin, lt[ < pivot == [lt, gt[ < [gt, end[
+TEST(TestPartition, Partition3s)
+{
+  // Normal Run - Random Array with duplicates of the pivot
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    auto pivot = randomdArray.begin() + 1;
+    const auto pivotVal = *pivot;
+
+    auto equalRange = Partition3<IT>(randomdArray.begin(), pivot, randomdArray.end());
+
+    // Pivot value 3 appears three times in the random array
+    EXPECT_EQ(3, std::distance(equalRange.first, equalRange.second));
+    for (auto it = randomdArray.begin(); it < equalRange.first; ++it)
+      EXPECT_GT(pivotVal, *it);
+    for (auto it = equalRange.first; it < equalRange.second; ++it)
+      EXPECT_EQ(pivotVal, *it);
+    for (auto it = equalRange.second; it < randomdArray.end(); ++it)
+      EXPECT_LT(pivotVal, *it);
+  }
+
+  // Unique value array - Whole sequence is the equal block
+  {
+    Container uniqueValueArray(100, 511);
+    auto equalRange = Partition3<IT>(uniqueValueArray.begin(), uniqueValueArray.begin() + 42,
+                                     uniqueValueArray.end());
+    EXPECT_EQ(uniqueValueArray.begin(), equalRange.first);
+    EXPECT_EQ(uniqueValueArray.end(), equalRange.second);
+  }
+
+  // Greater comparator - Should result in: [begin, lt[ > pivot == [lt, gt[ > [gt, end[
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    auto pivot = randomdArray.begin() + 1;
+    const auto pivotVal = *pivot;
+
+    auto equalRange = Partition3<IT, std::greater<int>>(randomdArray.begin(), pivot, randomdArray.end());
+    for (auto it = randomdArray.begin(); it < equalRange.first; ++it)
+      EXPECT_LT(pivotVal, *it);
+    for (auto it = equalRange.first; it < equalRange.second; ++it)
+      EXPECT_EQ(pivotVal, *it);
+    for (auto it = equalRange.second; it < randomdArray.end(); ++it)
+      EXPECT_GT(pivotVal, *it);
+  }
+
+  // Pivot choose as end or Begin and End inversed - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    auto equalRange = Partition3<IT>(randomdArray.begin(), randomdArray.end(), randomdArray.end());
+    EXPECT_EQ(randomdArray.end(), equalRange.first);
+    EXPECT_EQ(randomdArray.end(), equalRange.second);
+
+    Partition3<IT>(randomdArray.end(), randomdArray.begin() + 5, randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+}
+
+// Block Partition tests - Large sequences going through the branchless blocks
+TEST(TestPartition, BlockPartitions)
+{
+  const int kSize = 10000;
+
+  // Random integers - Should result in: max[begin, pivot[ <= pivot <= min]pivot, end]
+  for (int pivotIdx = 0; pivotIdx < kSize; pivotIdx += 1237)
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back((i * 7919) % 1009 - 500);
+    auto pivot = randomArray.begin() + pivotIdx;
+    const auto pivotVal = *pivot;
+
+    auto newPivot = BlockPartition<IT>(randomArray.begin(), pivot, randomArray.end());
+    CheckPartition<IT>(randomArray.begin(), randomArray.end(), newPivot, pivotVal);
+  }
+
+  // Random doubles through the Partition dispatch - Greater elements in the left partition
+  {
+    std::vector<double> randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(((i * 7919) % 1009) * 0.5);
+    auto pivot = randomArray.begin() + kSize / 3;
+    const auto pivotVal = *pivot;
+
+    auto newPivot = Partition<std::vector<double>::iterator, std::greater_equal<double>>
+      (randomArray.begin(), pivot, randomArray.end());
+    CheckPartition<std::vector<double>::iterator>
+      (randomArray.begin(), randomArray.end(), newPivot, pivotVal, false);
+  }
+
+  // Unique value array - All the elements belong to the left partition
+  {
+    Container uniqueValueArray(kSize, 511);
+    auto newPivot = Partition<IT>(uniqueValueArray.begin(), uniqueValueArray.begin(), uniqueValueArray.end());
+    EXPECT_EQ(uniqueValueArray.end() - 1, newPivot);
+    EXPECT_EQ(kSize, std::count(uniqueValueArray.begin(), uniqueValueArray.end(), 511));
+  }
+
+  // Non contiguous sequence - Should fallback on the Lomuto partition with the same result
+  {
+    std::deque<int> randomDeque;
+    for (int i = 0; i < kSize; ++i)
+      randomDeque.push_back((i * 7919) % 1009);
+    auto pivot = randomDeque.begin() + kSize / 2;
+    const auto pivotVal = *pivot;
+
+    auto newPivot = Partition<std::deque<int>::iterator>(randomDeque.begin(), pivot, randomDeque.end());
+    CheckPartition<std::deque<int>::iterator>(randomDeque.begin(), randomDeque.end(), newPivot, pivotVal);
+  }
+}
+
+// Partition of 32 / 64 bits arithmetic values (vectorized with AVX2)
+TEST(TestPartition, VectorizedPartitions)
+{
+  CheckStandardPartition<std::int32_t, std::less_equal<std::int32_t>>(-100000, 777);
+  CheckStandardPartition<std::int32_t, std::greater<std::int32_t>>(-100000, 777);
+  CheckStandardPartition<std::uint32_t, std::less<std::uint32_t>>(5, 1u << 24);
+  CheckStandardPartition<std::uint32_t, std::greater_equal<std::uint32_t>>(5, 1u << 24);
+  CheckStandardPartition<std::int64_t, std::less_equal<std::int64_t>>(-(1ll << 50), 1ll << 45);
+  CheckStandardPartition<std::uint64_t, std::greater<std::uint64_t>>(3, 1ull << 56);
+  CheckStandardPartition<float, std::less_equal<float>>(-10.f, 0.125f);
+  CheckStandardPartition<double, std::greater_equal<double>>(-1e10, 1e8);
+
+  // Already partitioned around the last element - Array should not be affected
+  {
+    Container sortedArray;
+    for (int i = 0; i < 1000; ++i)
+      sortedArray.push_back(i % 2 ? i : -i);
+    sortedArray.push_back(0);
+    const Container expected(sortedArray);
+
+    auto newPivot = Partition<IT>(sortedArray.begin(), sortedArray.end() - 1, sortedArray.end());
+    CheckPartition<IT>(sortedArray.begin(), sortedArray.end(), newPivot, 0);
+    EXPECT_EQ(500, std::distance(sortedArray.begin(), newPivot));
+  }
+}
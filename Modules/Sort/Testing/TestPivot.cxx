@@ -0,0 +1,168 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <pivot.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef std::greater_equal<IT::value_type> GE_Compare;
+}
+#endif /* DOXYGEN_SKIP */
+
+// Median of three tests
+TEST(TestPivot, MedianOfThrees)
+{
+  // All permutations of three values - Should return the median one
+  Container values = {1, 2, 3};
+  do
+  {
+    EXPECT_EQ(2, *MedianOfThree<IT>(values.begin(), values.begin() + 1, values.begin() + 2));
+    EXPECT_EQ(2, (*MedianOfThree<IT, GE_Compare>(values.begin(), values.begin() + 1, values.begin() + 2)));
+  } while (std::next_permutation(values.begin(), values.end()));
+
+  // Duplicate values - Should return the duplicated value
+  Container duplicates = {5, 1, 5};
+  EXPECT_EQ(5, *MedianOfThree<IT>(duplicates.begin(), duplicates.begin() + 1, duplicates.begin() + 2));
+}
+
+// Ninther and pivot selection tests
+TEST(TestPivot, SelectPivots)
+{
+  // Empty sequence - Should return end
+  {
+    Container emptyArray;
+    EXPECT_EQ(emptyArray.end(), Ninther<IT>(emptyArray.begin(), emptyArray.end()));
+    EXPECT_EQ(emptyArray.end(), SelectPivot<IT>(emptyArray.begin(), emptyArray.end()));
+  }
+
+  // Unique value array - Should return the unique element
+  {
+    Container uniqueValueArray(1, 511);
+    EXPECT_EQ(uniqueValueArray.begin(), Ninther<IT>(uniqueValueArray.begin(), uniqueValueArray.end()));
+    EXPECT_EQ(uniqueValueArray.begin(), SelectPivot<IT>(uniqueValueArray.begin(), uniqueValueArray.end()));
+  }
+
+  // Small sorted array - Should return the middle element
+  {
+    Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    EXPECT_EQ(8, *SelectPivot<IT>(sortedArray.begin(), sortedArray.end()));
+  }
+
+  // Large sorted array - Ninther should return the exact median
+  {
+    Container sortedArray;
+    for (int i = 0; i < 1001; ++i)
+      sortedArray.push_back(i);
+    EXPECT_EQ(500, *Ninther<IT>(sortedArray.begin(), sortedArray.end()));
+    EXPECT_EQ(500, *SelectPivot<IT>(sortedArray.begin(), sortedArray.end()));
+  }
+}
+
+// Per-thread pivot random generator tests
+TEST(TestPivot, PivotRandoms)
+{
+  // Same seed - Should replay the same sequence
+  {
+    PivotRandom::Seed(42);
+    std::vector<std::uint64_t> firstRun;
+    for (int i = 0; i < 16; ++i)
+      firstRun.push_back(PivotRandom::Next());
+
+    PivotRandom::Seed(42);
+    for (int i = 0; i < 16; ++i)
+      EXPECT_EQ(firstRun[i], PivotRandom::Next());
+  }
+
+  // Null seed - Should fall back on the default seed
+  {
+    PivotRandom::Seed(0);
+    const auto nullSeeded = PivotRandom::Next();
+    PivotRandom::Seed();
+    EXPECT_EQ(PivotRandom::Next(), nullSeeded);
+  }
+
+  // Uniform - Should stay within [0, count[
+  for (std::size_t count = 1; count < 100; ++count)
+    EXPECT_GT(count, PivotRandom::Uniform(count));
+
+  // Other threads - Should start from the default seed whatever the calling thread state
+  {
+    PivotRandom::Seed();
+    const auto expected = PivotRandom::Next();
+    PivotRandom::Next();
+
+    std::uint64_t fromThread = 0;
+    std::thread thread([&fromThread]() { fromThread = PivotRandom::Next(); });
+    thread.join();
+    EXPECT_EQ(expected, fromThread);
+  }
+}
+
+// Pivot selection policies tests
+TEST(TestPivot, PivotPolicies)
+{
+  // Empty sequence - Should return end
+  {
+    Container emptyArray;
+    EXPECT_EQ(emptyArray.end(), (AdaptivePivot::Select<IT, std::less_equal<int>>(emptyArray.begin(), emptyArray.end())));
+    EXPECT_EQ(emptyArray.end(), (MedianOfThreePivot::Select<IT, std::less_equal<int>>(emptyArray.begin(), emptyArray.end())));
+    EXPECT_EQ(emptyArray.end(), (NintherPivot::Select<IT, std::less_equal<int>>(emptyArray.begin(), emptyArray.end())));
+    EXPECT_EQ(emptyArray.end(), (MiddlePivot::Select<IT, std::less_equal<int>>(emptyArray.begin(), emptyArray.end())));
+    EXPECT_EQ(emptyArray.end(), (RandomPivot::Select<IT, std::less_equal<int>>(emptyArray.begin(), emptyArray.end())));
+  }
+
+  // Small sorted array - Deterministic policies should return the middle element
+  {
+    Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    EXPECT_EQ(8, (*AdaptivePivot::Select<IT, std::less_equal<int>>(sortedArray.begin(), sortedArray.end())));
+    EXPECT_EQ(8, (*MedianOfThreePivot::Select<IT, std::less_equal<int>>(sortedArray.begin(), sortedArray.end())));
+    EXPECT_EQ(8, (*MiddlePivot::Select<IT, std::less_equal<int>>(sortedArray.begin(), sortedArray.end())));
+  }
+
+  // Random pivot - Should stay within the sequence and be reproducible once seeded
+  {
+    Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    PivotRandom::Seed(7);
+    std::vector<IT> pivots;
+    for (int i = 0; i < 32; ++i)
+    {
+      pivots.push_back(RandomPivot::Select<IT, std::less_equal<int>>(sortedArray.begin(), sortedArray.end()));
+      EXPECT_TRUE(pivots.back() >= sortedArray.begin() && pivots.back() < sortedArray.end());
+    }
+
+    PivotRandom::Seed(7);
+    for (int i = 0; i < 32; ++i)
+      EXPECT_EQ(pivots[i], (RandomPivot::Select<IT, std::less_equal<int>>(sortedArray.begin(), sortedArray.end())));
+  }
+}
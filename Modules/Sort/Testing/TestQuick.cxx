@@ -21,6 +21,7 @@
 #include <quick.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <string>
@@ -131,3 +132,180 @@ TEST(TestSort, QuickSortGreaterComparator)
       EXPECT_GE(*it, *(it + 1));
   }
 }
+
+// Hybrid Quick-Sort tests - Inputs leading naive quick sorts to quadratic behavior
+TEST(TestSort, QuickSortAdversarialInputs)
+{
+  const int kSize = 10000;
+
+  // Unique value array - All elements remain
+  {
+    Container uniqueValueArray(kSize, 511);
+    QuickSort<IT>(uniqueValueArray.begin(), uniqueValueArray.end());
+    EXPECT_EQ(kSize, std::count(uniqueValueArray.begin(), uniqueValueArray.end(), 511));
+  }
+
+  // Few distinct values - All elements should be sorted
+  {
+    Container duplicatesArray;
+    for (int i = 0; i < kSize; ++i)
+      duplicatesArray.push_back((i * 7919) % 3);
+    QuickSort<IT>(duplicatesArray.begin(), duplicatesArray.end());
+
+    // All elements are sorted
+    for (auto it = duplicatesArray.begin(); it < duplicatesArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Organ pipe and inverse sorted arrays - Results should match std::sort
+  {
+    Container organPipeArray, invSortedArray;
+    for (int i = 0; i < kSize; ++i)
+    {
+      organPipeArray.push_back(i < kSize / 2 ? i : kSize - i);
+      invSortedArray.push_back(kSize - i);
+    }
+
+    Container expected(organPipeArray);
+    std::sort(expected.begin(), expected.end());
+    QuickSort<IT>(organPipeArray.begin(), organPipeArray.end());
+    EXPECT_EQ(expected, organPipeArray);
+
+    expected = invSortedArray;
+    std::sort(expected.begin(), expected.end());
+    QuickSort<IT>(invSortedArray.begin(), invSortedArray.end());
+    EXPECT_EQ(expected, invSortedArray);
+  }
+
+  // Insertion cutoffs - Results should match std::sort whatever the cutoff
+  for (int cutoff = 0; cutoff <= 64; cutoff += 16)
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back((i * 7919) % 1009 - 500);
+
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+    QuickSort<IT>(randomArray.begin(), randomArray.end(), cutoff);
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Greater comparator - Results should match std::sort in inverse order
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back((i * 7919) % 101);
+
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    QuickSort<IT, GE_Comparator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+}
+
+// Three-Way Quick-Sort tests
+TEST(TestSort, QuickSort3Ways)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    QuickSort3Way<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    QuickSort3Way<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    QuickSort3Way<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // Few distinct values over a large array - Results should match std::sort
+  for (int cutoff = 0; cutoff <= 32; cutoff += 16)
+  {
+    Container duplicatesArray;
+    for (int i = 0; i < 100000; ++i)
+      duplicatesArray.push_back((i * 7919) % 20);
+
+    Container expected(duplicatesArray);
+    std::sort(expected.begin(), expected.end());
+    QuickSort3Way<IT>(duplicatesArray.begin(), duplicatesArray.end(), cutoff);
+    EXPECT_EQ(expected, duplicatesArray);
+  }
+
+  // String - String should be sorted in inverse order
+  {
+    std::string stringToSort = RandomStr;
+    QuickSort3Way<std::string::iterator, std::greater<char>>(stringToSort.begin(), stringToSort.end());
+
+    // All elements are sorted in inverse order
+    for (auto it = stringToSort.begin(); it < stringToSort.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Pivot selection policies tests
+TEST(TestSort, QuickSortPivotPolicies)
+{
+  const int kSize = 5000;
+  Container reference(kSize);
+  for (int i = 0; i < kSize; ++i)
+    reference[i] = (i * 7919) % 1013;
+  Container expected = reference;
+  std::sort(expected.begin(), expected.end());
+
+  // Every policy - Should lead to the same sorted sequence, with both partitioning schemes
+  {
+    Container array = reference;
+    QuickSort<IT, std::less_equal<int>, MedianOfThreePivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+  {
+    Container array = reference;
+    QuickSort<IT, std::less_equal<int>, NintherPivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+  {
+    Container array = reference;
+    QuickSort<IT, std::less_equal<int>, MiddlePivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+  {
+    Container array = reference;
+    QuickSort<IT, std::less_equal<int>, RandomPivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+  {
+    Container array = reference;
+    QuickSort3Way<IT, std::less<int>, MiddlePivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+  {
+    Container array = reference;
+    QuickSort3Way<IT, std::less<int>, RandomPivot>(array.begin(), array.end());
+    EXPECT_EQ(expected, array);
+  }
+
+  // Random pivot - Same seed should lead to the same partitioning work
+  {
+    Container first = reference;
+    Container second = reference;
+    PivotRandom::Seed(3);
+    QuickSort<IT, std::less_equal<int>, RandomPivot>(first.begin(), first.begin() + kSize / 2);
+    PivotRandom::Seed(3);
+    QuickSort<IT, std::less_equal<int>, RandomPivot>(second.begin(), second.begin() + kSize / 2);
+    EXPECT_EQ(first, second);
+  }
+}
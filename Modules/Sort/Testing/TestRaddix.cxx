@@ -20,6 +20,15 @@
 #include <gtest/gtest.h>
 #include <raddix.hxx>
 
+// STD includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
 // Testing namespace
 using namespace SHA_Sort;
 
@@ -81,3 +90,258 @@ TEST(TestRaddix, RaddixSorts)
     EXPECT_EQ(511, uniqueValueArray[0]);
   }
 }
+
+// Raddix-Sort tests on large sequences and digit sizes
+TEST(TestRaddix, RaddixSortDigits)
+{
+  const int kSize = 10000;
+
+  // 8 and 11 bits digits - Results should match std::sort
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<int>((static_cast<unsigned int>(i) * 2654435761u) & 0x7FFFFFFF));
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    Container randomArray11(randomArray);
+    RaddixSort<IT>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+    RaddixSort<IT, 11>(randomArray11.begin(), randomArray11.end());
+    EXPECT_EQ(expected, randomArray11);
+  }
+
+  // 64 bits unsigned values - Results should match std::sort
+  {
+    std::vector<uint64_t> randomArray;
+    for (uint64_t i = 0; i < kSize; ++i)
+      randomArray.push_back(i * 0x9E3779B97F4A7C15ull);
+    std::vector<uint64_t> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<std::vector<uint64_t>::iterator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Small values sharing all their high digits - Skipped passes should not affect the result
+  {
+    Container smallArray;
+    for (int i = 0; i < kSize; ++i)
+      smallArray.push_back((i * 7919) % 200);
+    Container expected(smallArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<IT>(smallArray.begin(), smallArray.end());
+    EXPECT_EQ(expected, smallArray);
+  }
+
+  // String - String should be sorted as an array
+  {
+    std::string stringToSort = "xacvgeze";
+    RaddixSort<std::string::iterator>(stringToSort.begin(), stringToSort.end());
+    EXPECT_EQ("aceegvxz", stringToSort);
+  }
+}
+
+// Raddix-Sort tests on signed and floating point values
+TEST(TestRaddix, RaddixSortSignedAndFloatingPoints)
+{
+  const int kSize = 10000;
+
+  // Signed integers - Negative values should come first
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<int>(static_cast<unsigned int>(i) * 2654435761u));
+    randomArray.push_back(std::numeric_limits<int>::min());
+    randomArray.push_back(std::numeric_limits<int>::max());
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<IT>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // 64 bits signed integers - Results should match std::sort
+  {
+    std::vector<int64_t> randomArray;
+    for (uint64_t i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<int64_t>(i * 0x9E3779B97F4A7C15ull));
+    std::vector<int64_t> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<std::vector<int64_t>::iterator, 11>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Floats - Negative values, zeros and infinities should be ordered
+  {
+    std::vector<float> randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<float>((i * 7919) % 2001 - 1000) / 7.f);
+    randomArray.push_back(std::numeric_limits<float>::infinity());
+    randomArray.push_back(-std::numeric_limits<float>::infinity());
+    randomArray.push_back(std::numeric_limits<float>::denorm_min());
+    randomArray.push_back(-std::numeric_limits<float>::max());
+    std::vector<float> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<std::vector<float>::iterator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Doubles - Negative zero should come before positive zero
+  {
+    std::vector<double> randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<double>((i * 7919) % 2001 - 1000) * 1e-3);
+    randomArray.push_back(0.);
+    randomArray.push_back(-0.);
+    std::vector<double> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    RaddixSort<std::vector<double>::iterator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+
+    const auto zero = std::lower_bound(randomArray.begin(), randomArray.end(), 0.);
+    EXPECT_TRUE(std::signbit(*zero));
+    EXPECT_FALSE(std::signbit(*(zero + 1)));
+  }
+}
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  struct Record
+  {
+    int64_t timestamp;
+    int id;
+  };
+
+  struct RecordTimestamp
+  {
+    int64_t operator()(const Record& record) const { return record.timestamp; }
+  };
+}
+#endif /* DOXYGEN_SKIP */
+
+// Raddix-Sort tests with a key extractor
+TEST(TestRaddix, RaddixSortKeyExtractors)
+{
+  const int kSize = 10000;
+
+  // Records sorted by timestamp - Results should match std::stable_sort
+  {
+    std::vector<Record> records;
+    for (int i = 0; i < kSize; ++i)
+    {
+      Record record = {static_cast<int64_t>((i * 7919) % 500) - 250, i};
+      records.push_back(record);
+    }
+    std::vector<Record> expected(records);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Record& a, const Record& b) { return a.timestamp < b.timestamp; });
+
+    RaddixSort(records.begin(), records.end(), RecordTimestamp());
+    for (int i = 0; i < kSize; ++i)
+    {
+      EXPECT_EQ(expected[i].timestamp, records[i].timestamp);
+      EXPECT_EQ(expected[i].id, records[i].id);
+    }
+  }
+
+  // Lambda extractor and 11 bits digits - Integers sorted by decreasing order
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back((i * 7919) % 10007 - 5000);
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    const auto opposite = [](const int value) { return -static_cast<int64_t>(value); };
+    RaddixSort<IT, decltype(opposite), 11>(randomArray.begin(), randomArray.end(), opposite);
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    std::vector<Record> records(2);
+    records[0].timestamp = 2; records[0].id = 0;
+    records[1].timestamp = 1; records[1].id = 1;
+    RaddixSort(records.end(), records.begin(), RecordTimestamp());
+    EXPECT_EQ(0, records[0].id);
+    EXPECT_EQ(1, records[1].id);
+  }
+}
+
+// American Flag Sort tests
+TEST(TestRaddix, AmericanFlagSorts)
+{
+  const int kSize = 10000;
+
+  // Normal Run - array should be sorted in order
+  {
+    Container randomdArrayPos(RandomArrayIntPos, RandomArrayIntPos + sizeof(RandomArrayIntPos) / sizeof(int));
+    AmericanFlagSort<IT>(randomdArrayPos.begin(), randomdArrayPos.end());
+
+    // All elements are sorted
+    for (IT it = randomdArrayPos.begin(); it < randomdArrayPos.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomArrayPos(RandomArrayIntPos, RandomArrayIntPos + sizeof(RandomArrayIntPos) / sizeof(int));
+    AmericanFlagSort<IT>(randomArrayPos.end(), randomArrayPos.begin());
+
+    int i = 0;
+    for (IT it = randomArrayPos.begin(); it < randomArrayPos.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayIntPos[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    AmericanFlagSort<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // Signed integers with duplicates - Results should match std::sort
+  {
+    Container randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(i % 3 ? static_cast<int>(static_cast<unsigned int>(i) * 2654435761u) : i % 50 - 25);
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    AmericanFlagSort<IT>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Doubles - Results should match std::sort
+  {
+    std::vector<double> randomArray;
+    for (int i = 0; i < kSize; ++i)
+      randomArray.push_back(static_cast<double>((i * 7919) % 20011 - 10000) * 1e-2);
+    std::vector<double> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    AmericanFlagSort<std::vector<double>::iterator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+
+  // Strings of various lengths sharing long prefixes - Results should match std::sort
+  {
+    std::vector<std::string> randomArray;
+    for (int i = 0; i < kSize; ++i)
+    {
+      const auto value = (i * 7919) % 4001;
+      randomArray.push_back(std::string(value % 7, 'k') + std::to_string(value) + (value % 2 ? "\xE9" : ""));
+    }
+    randomArray.push_back("");
+    randomArray.push_back("");
+    std::vector<std::string> expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+
+    AmericanFlagSort<std::vector<std::string>::iterator>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+}
@@ -0,0 +1,186 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <sort.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Key / Payload record: only the key is compared
+  struct Record
+  {
+    int key;
+    int payload;
+  };
+  struct RecordLess
+  {
+    bool operator()(const Record& a, const Record& b) const { return a.key < b.key; }
+  };
+
+  // Sort a copy of the values and check it against std::sort, returning the engine picked
+  template <typename T, typename Compare>
+  SortEngine CheckSort(const std::vector<T>& values)
+  {
+    std::vector<T> expected(values);
+    std::sort(expected.begin(), expected.end(), Compare());
+
+    SortStats stats;
+    std::vector<T> sorted(values);
+    Sort<typename std::vector<T>::iterator, Compare>(sorted.begin(), sorted.end(), &stats);
+    EXPECT_EQ(expected, sorted);
+    EXPECT_EQ(values.size() < 2 ? 0 : values.size(), stats.size);
+
+    return stats.engine;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Sort dispatcher tests - Small sequences
+TEST(TestSort, SortSmallSequences)
+{
+  // Empty and unique element sequences - Nothing to sort
+  EXPECT_EQ(SortEngine::None, (CheckSort<int, std::less<int>>(Container())));
+  EXPECT_EQ(SortEngine::None, (CheckSort<int, std::less<int>>(Container(1, 511))));
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    Sort<IT>(randomdArray.end(), randomdArray.begin());
+    EXPECT_TRUE(std::equal(randomdArray.begin(), randomdArray.end(), RandomArrayInt));
+  }
+
+  // Small arithmetic sequences - Sorting network
+  const Container randomArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+  EXPECT_EQ(SortEngine::SortingNetwork, (CheckSort<int, std::less<int>>(randomArray)));
+  EXPECT_EQ(SortEngine::SortingNetwork, (CheckSort<int, std::greater<int>>(randomArray)));
+
+  // Small generic sequences - Insertion sort
+  {
+    std::vector<std::string> strings = {"xa", "cv", "ge", "ze", "aa", "cv"};
+    EXPECT_EQ(SortEngine::Insertion, (CheckSort<std::string, std::less<std::string>>(strings)));
+  }
+
+  // No stats - Should sort anyway
+  {
+    Container values(randomArray);
+    Sort<IT>(values.begin(), values.end());
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  }
+}
+
+// Sort dispatcher tests - Engine selection on large sequences
+TEST(TestSort, SortEngines)
+{
+  const int kSize = 5000;
+  std::mt19937 generator(3);
+
+  // Random integers - Raddix sort, in order and in inverse order
+  Container random(kSize);
+  for (auto& value : random)
+    value = static_cast<int>(generator() % 2000) - 1000;
+  EXPECT_EQ(SortEngine::Raddix, (CheckSort<int, std::less<int>>(random)));
+  EXPECT_EQ(SortEngine::Raddix, (CheckSort<int, std::greater<int>>(random)));
+  {
+    std::vector<double> doubles(random.begin(), random.end());
+    EXPECT_EQ(SortEngine::Raddix, (CheckSort<double, std::greater<double>>(doubles)));
+  }
+
+  // Sorted, reversed and nearly sorted integers - Natural merge sort
+  Container sorted(random);
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_EQ(SortEngine::NaturalMerge, (CheckSort<int, std::less<int>>(sorted)));
+  EXPECT_EQ(SortEngine::NaturalMerge, (CheckSort<int, std::greater<int>>(sorted)));
+  {
+    Container nearlySorted(sorted);
+    for (int i = 0; i < 20; ++i)
+      std::swap(nearlySorted[generator() % kSize], nearlySorted[generator() % kSize]);
+    SortStats stats;
+    Sort<IT>(nearlySorted.begin(), nearlySorted.end(), &stats);
+    EXPECT_EQ(SortEngine::NaturalMerge, stats.engine);
+    EXPECT_EQ(static_cast<std::size_t>(kSize), stats.scanned);
+    EXPECT_GE(40u, stats.descents);
+    EXPECT_TRUE(std::is_sorted(nearlySorted.begin(), nearlySorted.end()));
+  }
+
+  // Random integers - The scan should stop early
+  {
+    SortStats stats;
+    Container values(random);
+    Sort<IT>(values.begin(), values.end(), &stats);
+    EXPECT_GT(static_cast<std::size_t>(kSize / 2), stats.scanned);
+    EXPECT_EQ(0u, stats.sampleSize);
+  }
+
+  // Strings - American flag sort in lexicographical order, quick sorts otherwise
+  std::vector<std::string> strings;
+  for (int i = 0; i < kSize; ++i)
+    strings.push_back(std::to_string(generator()));
+  EXPECT_EQ(SortEngine::AmericanFlag, (CheckSort<std::string, std::less<std::string>>(strings)));
+  EXPECT_EQ(SortEngine::QuickSort, (CheckSort<std::string, std::greater<std::string>>(strings)));
+  {
+    std::vector<std::string> fewStrings;
+    for (int i = 0; i < kSize; ++i)
+      fewStrings.push_back(std::to_string(generator() % 10));
+    EXPECT_EQ(SortEngine::QuickSort3Way, (CheckSort<std::string, std::greater<std::string>>(fewStrings)));
+  }
+
+  // Records with many duplicated keys - Three-way quick sort
+  {
+    std::vector<Record> records(kSize);
+    for (int i = 0; i < kSize; ++i)
+      records[i] = {static_cast<int>(generator() % 8), i};
+
+    SortStats stats;
+    Sort<std::vector<Record>::iterator, RecordLess>(records.begin(), records.end(), &stats);
+    EXPECT_EQ(SortEngine::QuickSort3Way, stats.engine);
+    EXPECT_EQ(static_cast<std::size_t>(kSortDuplicateSampleSize), stats.sampleSize);
+    EXPECT_LE(kSortDuplicateRatio * stats.sampleSize, stats.sampleDuplicates);
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), RecordLess()));
+  }
+
+  // Integers below the raddix size - Quick sort
+  {
+    Container values(random.begin(), random.begin() + kSortRaddixMinSize / 2);
+    EXPECT_EQ(SortEngine::QuickSort, (CheckSort<int, std::less<int>>(values)));
+  }
+}
+
+// Sort engine names
+TEST(TestSort, SortEngineNames)
+{
+  EXPECT_STREQ("None", SortEngineName(SortEngine::None));
+  EXPECT_STREQ("NaturalMerge", SortEngineName(SortEngine::NaturalMerge));
+  EXPECT_STREQ("QuickSort", SortEngineName(SortEngine::QuickSort));
+}
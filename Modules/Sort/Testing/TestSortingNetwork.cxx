@@ -0,0 +1,187 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <sorting_network.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  // Sort every size up to the biggest network with a standard functor - Results should match std::sort
+  template <typename T, typename Compare>
+  void CheckSortingNetwork(const T firstValue, const T step)
+  {
+    for (int size = 0; size <= kSortingNetworkMaxSize; ++size)
+    {
+      std::vector<T> values;
+      for (int i = 0; i < size; ++i)
+        values.push_back(static_cast<T>(firstValue + step * static_cast<T>((i * 37) % 23)));
+      std::vector<T> expected(values);
+      std::sort(expected.begin(), expected.end());
+      if (SortingNetworkOrder<Compare, T>::value < 0)
+        std::reverse(expected.begin(), expected.end());
+
+      EXPECT_TRUE((TrySortingNetwork<typename std::vector<T>::iterator, Compare>(values.begin(), values.end())));
+      EXPECT_EQ(expected, values);
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Scalar Sorting Network tests
+TEST(TestSortingNetwork, SortingNetworks)
+{
+  // Normal Run - array should be sorted in order
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    SortingNetwork<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (IT it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container invArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    SortingNetwork<IT>(invArray.end(), invArray.begin());
+
+    int i = 0;
+    for (IT it = invArray.begin(); it < invArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error empty array
+  {
+    Container emptyArray;
+    SortingNetwork<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // String - String should be sorted in inverse order
+  {
+    std::string stringToSort = RandomStr;
+    SortingNetwork<std::string::iterator, std::greater<char>>(stringToSort.begin(), stringToSort.end());
+    EXPECT_EQ("zxvgeeca", stringToSort);
+  }
+
+  // Every size up to 100 of non arithmetic values - Results should match std::sort
+  for (int size = 0; size <= 100; ++size)
+  {
+    std::vector<std::string> values;
+    for (int i = 0; i < size; ++i)
+      values.push_back(std::to_string((i * 7919) % 101));
+    std::vector<std::string> expected(values);
+    std::sort(expected.begin(), expected.end());
+
+    SortingNetwork<std::vector<std::string>::iterator>(values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+  }
+}
+
+// Vectorized / Scalar kernels tests
+TEST(TestSortingNetwork, TrySortingNetworks)
+{
+  // Supported value types, in order and in inverse order
+  CheckSortingNetwork<std::int32_t, std::less<std::int32_t>>(-1000, 97);
+  CheckSortingNetwork<std::int32_t, std::greater_equal<std::int32_t>>(std::numeric_limits<std::int32_t>::min(), 1 << 26);
+  CheckSortingNetwork<std::uint32_t, std::less_equal<std::uint32_t>>(7, 1u << 27);
+  CheckSortingNetwork<float, std::less<float>>(-3.5f, 0.75f);
+  CheckSortingNetwork<double, std::greater<double>>(-1e300, 1e299);
+  CheckSortingNetwork<std::int64_t, std::less<std::int64_t>>(-(1ll << 40), 1ll << 37);
+  CheckSortingNetwork<char, std::less<char>>('a', 1);
+
+  // Infinite values are kept
+  {
+    std::vector<float> values(20, std::numeric_limits<float>::infinity());
+    values[3] = 1.f;
+    values[7] = -std::numeric_limits<float>::infinity();
+    TrySortingNetwork<std::vector<float>::iterator, std::less<float>>(values.begin(), values.end());
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(), values[0]);
+    EXPECT_EQ(1.f, values[1]);
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), values[19]);
+  }
+
+  // Too many elements - Array should not be affected
+  {
+    Container bigArray(kSortingNetworkMaxSize + 1, 0);
+    bigArray[0] = 1;
+    EXPECT_FALSE((TrySortingNetwork<IT, std::less<int>>(bigArray.begin(), bigArray.end())));
+    EXPECT_EQ(1, bigArray[0]);
+  }
+
+  // Custom functor or non arithmetic values - Array should not be affected
+  {
+    struct AbsLess
+    {
+      bool operator()(int a, int b) const { return std::abs(a) < std::abs(b); }
+    };
+    Container randomArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    EXPECT_FALSE((TrySortingNetwork<IT, AbsLess>(randomArray.begin(), randomArray.end())));
+    EXPECT_EQ(Container(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int)), randomArray);
+
+    std::vector<std::string> strings(3, "b");
+    strings[1] = "a";
+    EXPECT_FALSE((TrySortingNetwork<std::vector<std::string>::iterator, std::less<std::string>>(strings.begin(),
+                                                                                                strings.end())));
+    EXPECT_EQ("a", strings[1]);
+  }
+}
+
+// Small Sort tests
+TEST(TestSortingNetwork, SmallSorts)
+{
+  // Arithmetic values - Sorted by the networks
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    SmallSort<IT, std::less_equal<int>>(randomdArray.begin(), randomdArray.end());
+    Container expected(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, randomdArray);
+  }
+
+  // Bigger sequences - Sorted by the insertion sort
+  {
+    Container randomArray;
+    for (int i = 0; i < 500; ++i)
+      randomArray.push_back((i * 7919) % 1009 - 500);
+    Container expected(randomArray);
+    std::sort(expected.begin(), expected.end());
+    SmallSort<IT>(randomArray.begin(), randomArray.end());
+    EXPECT_EQ(expected, randomArray);
+  }
+}
@@ -0,0 +1,118 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <thread_pool.hxx>
+
+// STD includes
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Recursively fork a binary tree of tasks, counting the leaves
+  void ForkTree(ThreadPool& pool, std::atomic<int>& leaves, int depth)
+  {
+    if (depth == 0)
+    {
+      ++leaves;
+      return;
+    }
+
+    TaskGroup group(pool);
+    group.Run([&pool, &leaves, depth]() { ForkTree(pool, leaves, depth - 1); });
+    ForkTree(pool, leaves, depth - 1);
+    group.Wait();
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Thread pool and task group tests
+TEST(TestThreadPool, TaskGroups)
+{
+  // All submitted tasks are run before the group is joined - whatever the number of workers
+  for (unsigned int threadCount = 0; threadCount < 4; ++threadCount)
+  {
+    ThreadPool pool(threadCount);
+    EXPECT_EQ(threadCount, pool.Size());
+
+    std::atomic<int> counter(0);
+    TaskGroup group(pool);
+    for (int i = 0; i < 1000; ++i)
+      group.Run([&counter]() { ++counter; });
+    group.Wait();
+
+    EXPECT_EQ(1000, counter.load());
+    EXPECT_FALSE(pool.RunPendingTask());
+  }
+
+  // Nested fork-join - Should not dead-lock and run all the leaves
+  {
+    ThreadPool pool(2);
+    std::atomic<int> leaves(0);
+    ForkTree(pool, leaves, 10);
+    EXPECT_EQ(1 << 10, leaves.load());
+  }
+
+  // Exception thrown within a task - Should be forwarded to the waiting thread
+  {
+    ThreadPool pool(2);
+    TaskGroup group(pool);
+    group.Run([]() { throw std::runtime_error("task failure"); });
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+  }
+}
+
+// Barrier tests
+TEST(TestThreadPool, Barriers)
+{
+  // Each thread should see the increments of all the threads of the previous round
+  const int kThreadCount = 4;
+  const int kRounds = 50;
+  Barrier barrier(kThreadCount);
+  std::atomic<int> counter(0);
+  std::atomic<int> errors(0);
+
+  auto run = [&]()
+  {
+    for (int round = 1; round <= kRounds; ++round)
+    {
+      ++counter;
+      barrier.Wait();
+      if (counter.load() != round * kThreadCount)
+        ++errors;
+      barrier.Wait();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < kThreadCount; ++i)
+    threads.push_back(std::thread(run));
+  run();
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(kThreadCount * kRounds, counter.load());
+  EXPECT_EQ(0, errors.load());
+}
@@ -0,0 +1,58 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <traits.hxx>
+
+// STD includes
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace SHA_Sort;
+
+// Contiguous iterators detection
+TEST(TestTraits, IsContiguousIterators)
+{
+  // Contiguous memory
+  EXPECT_TRUE(IsContiguousIterator<int*>::value);
+  EXPECT_TRUE(IsContiguousIterator<const double*>::value);
+  EXPECT_TRUE(IsContiguousIterator<std::vector<int>::iterator>::value);
+  EXPECT_TRUE(IsContiguousIterator<std::vector<std::string>::const_iterator>::value);
+  EXPECT_TRUE(IsContiguousIterator<std::string::iterator>::value);
+
+  // Non contiguous memory
+  EXPECT_FALSE(IsContiguousIterator<std::vector<bool>::iterator>::value);
+  EXPECT_FALSE(IsContiguousIterator<std::deque<int>::iterator>::value);
+  EXPECT_FALSE(IsContiguousIterator<std::list<int>::iterator>::value);
+}
+
+// Contiguous arithmetic sequences detection
+TEST(TestTraits, IsContiguousArithmetics)
+{
+  EXPECT_TRUE(IsContiguousArithmetic<int*>::value);
+  EXPECT_TRUE(IsContiguousArithmetic<std::vector<double>::iterator>::value);
+  EXPECT_TRUE(IsContiguousArithmetic<std::string::iterator>::value);
+
+  EXPECT_FALSE(IsContiguousArithmetic<bool*>::value);
+  EXPECT_FALSE(IsContiguousArithmetic<std::vector<std::string>::iterator>::value);
+  EXPECT_FALSE(IsContiguousArithmetic<std::deque<int>::iterator>::value);
+}
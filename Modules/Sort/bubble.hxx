@@ -20,8 +20,14 @@
 #ifndef MODULE_SORT_BUBBLE_HXX
 #define MODULE_SORT_BUBBLE_HXX
 
+#include <sorting_network.hxx>
+#include <traits.hxx>
+
 // STD includes
+#include <functional>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace SHA_Sort
 {
@@ -60,6 +66,246 @@ namespace SHA_Sort
         break;
     }
   }
+
+  /// IsOddEvenVectorized - Whether the odd-even transposition passes are vectorized: contiguous int32,
+  /// uint32, float or double values ordered by a standard functor (std::less, std::less_equal, std::greater,
+  /// std::greater_equal).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type.
+  template <typename IT,
+            typename Compare,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsOddEvenVectorized : std::integral_constant<bool,
+    IsContiguousIterator<IT>::value && SortingNetworkHasKernel<Value>::value &&
+    SortingNetworkOrder<Compare, Value>::value != 0>
+  {};
+
+  /// @class OddEvenPass
+  ///
+  /// Odd-even transposition pass: compare-exchange the disjoint pairs of neighbours (i, i + 1), i going from
+  /// first to last by steps of 2 - conditional moves on arithmetic values, conditional swaps otherwise.
+  /// Pairs being disjoint, they can be processed in any order: vectorized or split across threads.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less in order, std::greater for inverse order).
+  template <typename IT,
+            typename Compare,
+            bool IsVectorized = IsOddEvenVectorized<IT, Compare>::value>
+  class OddEvenPass
+  {
+    public:
+      explicit OddEvenPass(const IT& begin) : begin(begin) {}
+
+      /// Proceed the pass.
+      ///
+      /// @param first index of the first pair.
+      /// @param last index following the one of the last pair (lower than the number of elements).
+      /// @param firstSwap,lastSwap set to indices at most / at least the ones of the first / last swapped pairs.
+      ///
+      /// @return whether some pairs have been swapped.
+      bool operator()(const int first, const int last, int& firstSwap, int& lastSwap) const
+      {
+        typedef std::is_arithmetic<typename std::iterator_traits<IT>::value_type> IsArithmetic;
+
+        firstSwap = last;
+        lastSwap = first;
+        return this->Run(first, last, firstSwap, lastSwap, IsArithmetic());
+      }
+
+      /// Proceed the pass, without tracking the swapped pairs.
+      ///
+      /// @return whether some pairs have been swapped.
+      bool operator()(const int first, const int last) const
+      {
+        int firstSwap, lastSwap;
+        return (*this)(first, last, firstSwap, lastSwap);
+      }
+
+    private:
+      bool Run(const int first, const int last, int& firstSwap, int& lastSwap, std::true_type) const
+      {
+        auto hasSwapped = false;
+        for (auto i = first; i < last; i += 2)
+        {
+          const auto it = this->begin + i;
+          const auto left = *it;
+          const auto right = *(it + 1);
+          const bool isSwapped = Compare()(right, left);
+          *it = isSwapped ? right : left;
+          *(it + 1) = isSwapped ? left : right;
+
+          firstSwap = (isSwapped && !hasSwapped) ? i : firstSwap;
+          lastSwap = isSwapped ? i : lastSwap;
+          hasSwapped |= isSwapped;
+        }
+
+        return hasSwapped;
+      }
+
+      bool Run(const int first, const int last, int& firstSwap, int& lastSwap, std::false_type) const
+      {
+        auto hasSwapped = false;
+        for (auto i = first; i < last; i += 2)
+          if (Compare()(*(this->begin + i + 1), *(this->begin + i)))
+          {
+            std::iter_swap(this->begin + i, this->begin + i + 1);
+            firstSwap = hasSwapped ? firstSwap : i;
+            lastSwap = i;
+            hasSwapped = true;
+          }
+
+        return hasSwapped;
+      }
+
+      IT begin; // First element of the sequence
+  };
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#if defined(__AVX2__)
+  inline SortingNetworkRegister OddEvenDifference(const SortingNetworkRegister a, const SortingNetworkRegister b)
+  { return _mm256_xor_si256(a, b); }
+
+  inline SortingNetworkRegister OddEvenUnion(const SortingNetworkRegister a, const SortingNetworkRegister b)
+  { return _mm256_or_si256(a, b); }
+
+  inline bool OddEvenIsZero(const SortingNetworkRegister value) { return _mm256_testz_si256(value, value) != 0; }
+#else
+  inline SortingNetworkRegister OddEvenDifference(const SortingNetworkRegister a, const SortingNetworkRegister b)
+  { return _mm_xor_si128(a, b); }
+
+  inline SortingNetworkRegister OddEvenUnion(const SortingNetworkRegister a, const SortingNetworkRegister b)
+  { return _mm_or_si128(a, b); }
+
+  inline bool OddEvenIsZero(const SortingNetworkRegister value) { return _mm_testz_si128(value, value) != 0; }
+#endif
+
+  /// @class OddEvenPass
+  ///
+  /// Vectorized odd-even transposition pass on contiguous int32, uint32, float and double values: each
+  /// register holds whole pairs, exchanged with a lane shuffle, then min / max are blended back in place.
+  /// Ties (and NaN values) keep their bits so that a sorted sequence is never reported as swapped.
+  template <typename IT, typename Compare>
+  class OddEvenPass<IT, Compare, true>
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    typedef SortingNetworkLanes<Value> Lanes;
+
+    static const int kLanes = kSortingNetworkRegisterSlots / Lanes::kSlots;
+    static const int kOrder = SortingNetworkOrder<Compare, Value>::value;
+
+    public:
+      explicit OddEvenPass(const IT& begin) : data(&*begin), scalarPass(begin)
+      {
+        int permutation[kSortingNetworkRegisterSlots];
+        bool upper[kSortingNetworkRegisterSlots];
+        for (int lane = 0; lane < kLanes; ++lane)
+        {
+          permutation[lane] = lane ^ 1;
+          upper[lane] = (lane & 1) != 0;
+        }
+        this->partners = SortingNetworkPermutation(permutation, Lanes::kSlots);
+        this->upperMask = SortingNetworkMask(upper, Lanes::kSlots);
+      }
+
+      /// Proceed the pass (see OddEvenPass).
+      bool operator()(const int first, const int last, int& firstSwap, int& lastSwap) const
+      {
+        firstSwap = last;
+        lastSwap = first;
+
+        // Branchless tracking of the first / last registers holding swapped pairs
+        auto i = first;
+        for (; i + kLanes <= last + 1; i += kLanes)
+        {
+          const auto isSwapped = !OddEvenIsZero(this->Exchange(i));
+          firstSwap = std::min(firstSwap, isSwapped ? i : last);
+          lastSwap = isSwapped ? i + kLanes - 2 : lastSwap;
+        }
+        auto hasSwapped = firstSwap < last;
+
+        // Remaining pairs
+        int tailFirstSwap, tailLastSwap;
+        if (this->scalarPass(i, last, tailFirstSwap, tailLastSwap))
+        {
+          firstSwap = hasSwapped ? firstSwap : tailFirstSwap;
+          lastSwap = tailLastSwap;
+          hasSwapped = true;
+        }
+
+        return hasSwapped;
+      }
+
+      /// Proceed the pass (see OddEvenPass), without tracking the swapped pairs.
+      bool operator()(const int first, const int last) const
+      {
+        auto changes = OddEvenDifference(this->partners, this->partners);
+        auto i = first;
+        for (; i + kLanes <= last + 1; i += kLanes)
+          changes = OddEvenUnion(changes, this->Exchange(i));
+
+        // Remaining pairs
+        return this->scalarPass(i, last) || !OddEvenIsZero(changes);
+      }
+
+    private:
+      /// Compare-exchange the pairs of the register starting at index i.
+      ///
+      /// @return bits changed by the exchange.
+      SortingNetworkRegister Exchange(const int i) const
+      {
+        const auto values = SortingNetworkLoad(this->data + i);
+        const auto swapped = SortingNetworkShuffle(values, this->partners);
+        const auto low = (kOrder > 0) ? Lanes::Min(swapped, values) : Lanes::Max(swapped, values);
+        const auto high = (kOrder > 0) ? Lanes::Max(swapped, values) : Lanes::Min(swapped, values);
+        const auto sorted = SortingNetworkBlend(low, high, this->upperMask);
+        SortingNetworkStore(this->data + i, sorted);
+
+        return OddEvenDifference(values, sorted);
+      }
+
+      Value* data;                                  // First element of the sequence
+      OddEvenPass<IT, Compare, false> scalarPass;   // Pass on the pairs left by the registers
+      SortingNetworkRegister partners;              // Exchange the lanes of each pair
+      SortingNetworkRegister upperMask;             // Second lane of each pair
+  };
+#endif
+
+  /// Odd Even Bubble - Odd-even transposition variant of the bubble sort: passes alternately compare-exchange
+  /// the pairs of neighbours starting at even and at odd indices. The pairs of a pass being disjoint, each pass
+  /// is vectorized on contiguous int32, uint32, float and double values ordered by a standard functor
+  /// (AVX2 / SSE4.1) and can be split across threads (see ParallelOddEvenBubble).
+  ///
+  /// @remark once both parities have been processed, a pass without swap ends the sort: the pairs of the other
+  /// parity have been sorted by the previous pass and left untouched since.
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N^2) compare-exchanges in the worst case (N passes), O(N) on already sorted sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order): equivalent
+  /// elements would be swapped on each pass, defeating the early exit.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void OddEvenBubble(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Each element moves by one position at most per pass: sorted after N passes
+    const OddEvenPass<IT, Compare> pass(begin);
+    for (auto i = 0; i < distance; ++i)
+      if (!pass(i & 1, distance - 1) && i > 0)
+        break;
+  }
 }
 
 #endif // MODULE_SORT_BUBBLE_HXX
@@ -20,7 +20,11 @@
 #ifndef MODULE_SORT_COKTAIL_HXX
 #define MODULE_SORT_COKTAIL_HXX
 
+#include <bubble.hxx>
+
 // STD includes
+#include <algorithm>
+#include <functional>
 #include <iterator>
 
 namespace SHA_Sort
@@ -71,6 +75,54 @@ namespace SHA_Sort
       ++beginIdx;
     }
   }
+
+  /// Odd Even Cocktail - Odd-even transposition variant of the cocktail sort: passes alternately
+  /// compare-exchange the pairs of neighbours starting at even and at odd indices (see OddEvenBubble), while
+  /// both ends of the processed range narrow down as within the cocktail sort. A swap can only break the order
+  /// of the neighbour pairs: each pass is restricted to the pairs surrounding the swaps of the previous one.
+  ///
+  /// @remark the cost follows the extent of the disorder: to be used on small, nearly sorted sequences.
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N^2) compare-exchanges in the worst case (N passes), O(N) on already sorted sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order): equivalent
+  /// elements would be swapped on each pass, defeating the early exit.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void OddEvenCocktail(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Each element moves by one position at most per pass: sorted after N passes
+    const OddEvenPass<IT, Compare> pass(begin);
+    auto beginIdx = 0;
+    auto endIdx = distance - 1;
+    for (auto i = 0; i < distance; ++i)
+    {
+      int firstSwap, lastSwap;
+      const auto hasSwapped = pass(beginIdx + ((beginIdx ^ i) & 1), endIdx, firstSwap, lastSwap);
+      if (!hasSwapped && i > 0)
+        break;
+
+      // Both parities processed on the whole sequence: narrow the next pass around the swaps
+      if (i > 0)
+      {
+        beginIdx = std::max(0, firstSwap - 1);
+        endIdx = std::min(distance - 1, lastSwap + 2);
+      }
+    }
+  }
 }
 
 #endif // MODULE_SORT_COKTAIL_HXX
@@ -20,15 +20,119 @@
 #ifndef MODULE_SORT_COMB_HXX
 #define MODULE_SORT_COMB_HXX
 
+#include <insertion.hxx>
+#include <sorting_network.hxx>
+#include <traits.hxx>
+
 // STD includes
+#include <functional>
 #include <iterator>
+#include <type_traits>
 
 namespace SHA_Sort
 {
+  /// Comb sort gaps, in increasing order: each gap is the previous one multiplied by the 1.3 shrink factor
+  /// (rounded up) and the "rule of 11" is applied (11, 8, 6, 4, 3, 2, 1 rather than 10 or 9, 7, 5...).
+  const int kCombGaps[] = {
+    1, 2, 3, 4, 6, 8, 11, 15, 20, 26, 34, 45, 59, 77, 101, 132, 172, 224, 292, 380, 494, 643, 836,
+    1087, 1414, 1839, 2391, 3109, 4042, 5255, 6832, 8882, 11547, 15012, 19516, 25371, 32983, 42878,
+    55742, 72465, 94205, 122467, 159208, 206971, 269063, 349782, 454717, 591133, 768473, 999015,
+    1298720, 1688336, 2194837, 2853289, 3709276, 4822059, 6268677, 8149281, 10594066, 13772286,
+    17903972, 23275164, 30257714, 39335029, 51135538, 66476200, 86419060, 112344778, 146048212,
+    189862676, 246821479, 320867923, 417128300, 542266790, 704946827, 916430876, 1191360139,
+    1548768181, 2013398636 };
+
+  /// Number of gaps within kCombGaps.
+  const int kCombGapsSize = static_cast<int>(sizeof(kCombGaps) / sizeof(int));
+
+  /// Comb Pass - Compare-exchange every element with the one gap further, from the first to the last:
+  /// conditional moves for arithmetic values, conditional swaps otherwise.
+  template <typename IT, typename Compare>
+  void CombPass(const IT& begin, const IT& end, const int gap, std::false_type)
+  {
+    typedef std::is_arithmetic<typename std::iterator_traits<IT>::value_type> IsArithmetic;
+
+    const auto last = end - gap;
+    for (auto it = begin; it < last; ++it)
+      SortingNetworkExchange<IT, Compare>(it, it + gap, IsArithmetic());
+  }
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+  /// Comb Pass Vectorized - Same pass as CombPass comparing whole registers against the registers gap
+  /// further through min / max: as long as the gap is not smaller than a register, the register compared
+  /// on the left has been fully updated by the previous registers, leading to the exact same result.
+  ///
+  /// @tparam T type of the values (int32, uint32, float or double).
+  /// @tparam Order 1 to sort in order, -1 in inverse order.
+  ///
+  /// @param data contiguous values.
+  /// @param distance number of values.
+  /// @param gap distance between the compared values.
+  ///
+  /// @return void.
+  template <typename T, int Order>
+  void CombPassVectorized(T* data, const int distance, const int gap)
+  {
+    typedef SortingNetworkLanes<T> Lanes;
+    const int kLanes = kSortingNetworkRegisterSlots / Lanes::kSlots;
+
+    auto i = 0;
+    if (gap >= kLanes)
+      for (; i + gap + kLanes <= distance; i += kLanes)
+      {
+        const auto left = SortingNetworkLoad(data + i);
+        const auto right = SortingNetworkLoad(data + i + gap);
+        SortingNetworkStore(data + i, (Order > 0) ? Lanes::Min(left, right) : Lanes::Max(left, right));
+        SortingNetworkStore(data + i + gap, (Order > 0) ? Lanes::Max(left, right) : Lanes::Min(left, right));
+      }
+
+    // Remaining elements, or gap smaller than a register
+    typedef typename std::conditional<(Order > 0), std::less<T>, std::greater<T>>::type Compare;
+    for (; i + gap < distance; ++i)
+      SortingNetworkExchange<T*, Compare>(data + i, data + i + gap, std::true_type());
+  }
+#endif
+
+  /// Comb Pass - Vectorized pass on contiguous int32, uint32, float and double values (AVX2 / SSE4.1).
+  template <typename IT, typename Compare>
+  void CombPass(const IT& begin, const IT& end, const int gap, std::true_type)
+  {
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    CombPassVectorized<Value, SortingNetworkOrder<Compare, Value>::value>
+      (&*begin, static_cast<int>(std::distance(begin, end)), gap);
+#else
+    CombPass<IT, Compare>(begin, end, gap, std::false_type());
+#endif
+  }
+
+  /// IsCombVectorized - Whether the comb passes are vectorized: contiguous int32, uint32, float or double
+  /// values ordered by a standard functor (std::less, std::less_equal, std::greater, std::greater_equal).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type.
+  template <typename IT,
+            typename Compare,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsCombVectorized : std::integral_constant<bool,
+    IsContiguousIterator<IT>::value && SortingNetworkHasKernel<Value>::value &&
+    SortingNetworkOrder<Compare, Value>::value != 0>
+  {};
+
   /// Comb Sort - Proceed an in-place sort on the elements.
+  /// Elements are compare-exchanged with the ones a gap further, the gap shrinking on each pass
+  /// (see kCombGaps) so that small elements far at the end quickly move to the front: once the gap reaches 1,
+  /// the elements are close to their final position and the sort is completed by an insertion sort.
+  ///
+  /// @remark O(1) memory: passes are branchless on arithmetic values and vectorized on contiguous
+  /// int32, uint32, float and double values ordered by a standard functor (AVX2 / SSE4.1).
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N log N) compare-exchanges for the passes in practice, O(N^2) in the worst case.
   ///
   /// @tparam IT type using to go through the collection.
-  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Compare functor type (std::less in order, std::greater for inverse order).
   ///
   /// @param begin,end iterators to the initial and final positions of
   /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
@@ -43,26 +147,16 @@ namespace SHA_Sort
     if (distance < 2)
       return;
 
-    auto gap = distance;
-    double shrink = 1.3;
-    bool hasSwapped = true;
-    while (hasSwapped)
-    {
-      hasSwapped = false;
-
-      gap /= shrink;
-      if (gap > 1)
-        hasSwapped = true;
-      else
-        gap = 1;
-
-      for (auto it = begin; it + gap < end; ++it)
-        if (Compare()(*(it + gap), *it))
-        {
-          std::swap(*it, *(it + gap));
-          hasSwapped = true;
-        }
-    }
+    // Start from the largest gap smaller than the number of elements
+    auto gapIndex = kCombGapsSize - 1;
+    while (kCombGaps[gapIndex] >= distance)
+      --gapIndex;
+
+    for (; gapIndex > 0; --gapIndex)
+      CombPass<IT, Compare>(begin, end, kCombGaps[gapIndex], typename IsCombVectorized<IT, Compare>::type());
+
+    // Gap of 1: the elements are close to their position
+    InsertionSort<IT, Compare>(begin, end);
   }
 }
 
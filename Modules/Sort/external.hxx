@@ -0,0 +1,382 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_EXTERNAL_HXX
+#define MODULE_SORT_EXTERNAL_HXX
+
+#include <merge.hxx>
+#include <merge_k.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// External Sort Counters - Progress and I/O counters of an external sort.
+  struct ExternalSortCounters
+  {
+    ExternalSortCounters() : bytesRead(0), bytesWritten(0), records(0), runs(0), mergePass(0), mergedRecords(0) {}
+
+    std::uint64_t bytesRead;     ///< Bytes read from the input and from the runs
+    std::uint64_t bytesWritten;  ///< Bytes written to the runs and to the output
+    std::uint64_t records;       ///< Records read from the input
+    std::uint64_t runs;          ///< Sorted runs written to temporary files (initial and intermediate ones)
+    int mergePass;               ///< Current merge pass, 0 while the runs are spilled
+    std::uint64_t mergedRecords; ///< Records written by the current merge pass
+  };
+
+  /// External Sort Options - Memory budget and I/O configuration of an external sort.
+  struct ExternalSortOptions
+  {
+    ExternalSortOptions() : memoryBudget(std::size_t(256) << 20), bufferSize(std::size_t(1) << 20), isStable(true) {}
+
+    std::size_t memoryBudget;    ///< Bytes of records held in memory at once
+    std::size_t bufferSize;      ///< Bytes of each run buffer during the merges: bounds the merge fan-in
+    bool isStable;               ///< Runs sorted by MergeSort (stable) or by QuickSort (bigger runs)
+    std::string temporaryPrefix; ///< Prefix of the run files, "<output>.run" if empty
+    std::function<void(const ExternalSortCounters&)> progress; ///< Called after each run and each output flush
+  };
+
+  /// External File - Binary file of records read and written by large sequential blocks.
+  ///
+  /// @tparam T type of the records (trivially copyable).
+  template <typename T>
+  class ExternalFile
+  {
+  public:
+    ExternalFile(const std::string& path, const char* mode, const std::size_t bufferRecords,
+                 ExternalSortCounters& counters)
+      : file(std::fopen(path.c_str(), mode)), buffer(std::max<std::size_t>(bufferRecords, 1)),
+        position(0), size(0), isWriting(mode[0] == 'w'), isFailed(file == nullptr), counters(counters) {}
+
+    ~ExternalFile() { Close(); }
+
+    /// Whether an I/O error happened.
+    bool IsFailed() const { return isFailed; }
+
+    /// Read up to count records, return the number of records read.
+    std::size_t Read(T* records, const std::size_t count)
+    {
+      if (isFailed)
+        return 0;
+
+      const auto read = std::fread(records, sizeof(T), count, file);
+      isFailed = read < count && std::ferror(file);
+      counters.bytesRead += read * sizeof(T);
+      return read;
+    }
+
+    /// Read the next record through the buffer, return false once the file is over.
+    bool Next(T& record)
+    {
+      if (position == size)
+      {
+        size = Read(buffer.data(), buffer.size());
+        position = 0;
+        if (size == 0)
+          return false;
+      }
+
+      record = buffer[position++];
+      return true;
+    }
+
+    /// Write count records.
+    void Write(const T* records, const std::size_t count)
+    {
+      if (isFailed || count == 0)
+        return;
+
+      isFailed = std::fwrite(records, sizeof(T), count, file) != count;
+      counters.bytesWritten += count * sizeof(T);
+    }
+
+    /// Write a record through the buffer, return true if the buffer has been flushed.
+    bool Push(const T& record)
+    {
+      buffer[size++] = record;
+      if (size < buffer.size())
+        return false;
+
+      Flush();
+      return true;
+    }
+
+    /// Write the buffered records.
+    void Flush()
+    {
+      Write(buffer.data(), size);
+      size = 0;
+    }
+
+    /// Flush the buffered records and close the file, return false if any I/O error happened.
+    bool Close()
+    {
+      if (file == nullptr)
+        return !isFailed;
+
+      if (isWriting)
+        Flush();
+      isFailed = (std::fclose(file) != 0) || isFailed;
+      file = nullptr;
+      return !isFailed;
+    }
+
+  private:
+    ExternalFile(const ExternalFile&);
+    ExternalFile& operator=(const ExternalFile&);
+
+    std::FILE* file;                 // Underlying file
+    std::vector<T> buffer;           // Records read ahead or waiting to be written
+    std::size_t position;            // Next buffered record to be read
+    std::size_t size;                // Number of buffered records
+    bool isWriting;                  // Whether the file is opened for writing
+    bool isFailed;                   // Whether an I/O error happened
+    ExternalSortCounters& counters;  // I/O counters
+  };
+
+  /// External Merge Runs - k-way merge of sorted run files into a single file through a loser tree.
+  ///
+  /// @tparam T type of the records (trivially copyable).
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param runs paths of the sorted run files, in their input order.
+  /// @param outputPath path of the merged file.
+  /// @param bufferRecords number of records of each run / output buffer.
+  /// @param counters I/O counters.
+  /// @param progress called after each output buffer flush (may be empty).
+  ///
+  /// @return false if any I/O error happened.
+  template <typename T,
+            typename Compare = std::less<T>>
+  bool ExternalMergeRuns(const std::vector<std::string>& runs, const std::string& outputPath,
+                         const std::size_t bufferRecords, ExternalSortCounters& counters,
+                         const std::function<void(const ExternalSortCounters&)>& progress)
+  {
+    std::vector<std::unique_ptr<ExternalFile<T>>> inputs;
+    LoserTree<T, Compare> tree(runs.size());
+    auto isFailed = false;
+    for (std::size_t i = 0; i < runs.size(); ++i)
+    {
+      inputs.emplace_back(new ExternalFile<T>(runs[i], "rb", bufferRecords, counters));
+      T head;
+      if (inputs.back()->Next(head))
+        tree.Set(i, head);
+      isFailed = isFailed || inputs.back()->IsFailed();
+    }
+    tree.Build();
+
+    {
+      ExternalFile<T> output(outputPath, "wb", bufferRecords, counters);
+      while (!isFailed && !tree.IsEmpty())
+      {
+        const auto flushed = output.Push(tree.Top());
+        ++counters.mergedRecords;
+
+        T next;
+        if (inputs[tree.Winner()]->Next(next))
+          tree.Replace(next);
+        else
+          tree.Exhaust();
+
+        if (flushed && progress)
+          progress(counters);
+        isFailed = output.IsFailed();
+      }
+      isFailed = !output.Close() || isFailed;
+    }
+
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+      isFailed = !inputs[i]->Close() || isFailed;
+
+    return !isFailed;
+  }
+
+  /// External Replace - Move a file over another one.
+  ///
+  /// @param from path of the file to be moved.
+  /// @param to path of the file to be replaced.
+  ///
+  /// @return false if the file could not be moved.
+  inline bool ExternalReplace(const std::string& from, const std::string& to)
+  {
+    if (std::rename(from.c_str(), to.c_str()) == 0)
+      return true;
+
+    // Existing files are not replaced on every platform
+    std::remove(to.c_str());
+    return std::rename(from.c_str(), to.c_str()) == 0;
+  }
+
+  /// External Sort - Sort a binary file of fixed-size records that does not fit in memory (out-of-core
+  /// merge sort):
+  /// - Chunks fitting the memory budget are read, sorted in memory (MergeSort if stable, QuickSort
+  ///   otherwise) and spilled as sorted runs to temporary files.
+  /// - Runs are k-way merged through a loser tree, reading and writing large sequential blocks. If there
+  ///   are more runs than buffers fitting the memory budget, runs are first merged by groups (multi-pass).
+  /// Temporary run files are removed once merged.
+  /// The sorted records are written to a temporary file moved over the output only once complete.
+  ///
+  /// @remark the input file may be the output one: it is left untouched if any I/O error happens.
+  ///
+  /// @complexity O(N log N) comparisons, O(N log_k(R)) I/O with R runs and a merge fan-in of k.
+  ///
+  /// @tparam T type of the records (trivially copyable).
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param inputPath path of the binary file of records to be sorted.
+  /// @param outputPath path of the sorted binary file.
+  /// @param options memory budget, buffers size, stability, temporary files and progress callback.
+  /// @param counters progress and I/O counters (may be null).
+  ///
+  /// @return false if any I/O error happened. If only moving the sorted records over the output failed, they
+  /// are left within the temporary file prefix + ".out".
+  template <typename T,
+            typename Compare = std::less<T>>
+  bool ExternalSort(const std::string& inputPath, const std::string& outputPath,
+                    const ExternalSortOptions& options = ExternalSortOptions(),
+                    ExternalSortCounters* counters = nullptr)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "ExternalSort requires trivially copyable records");
+
+    ExternalSortCounters localCounters;
+    auto& stats = counters ? *counters : localCounters;
+    stats = ExternalSortCounters();
+    const auto prefix = options.temporaryPrefix.empty() ? outputPath + ".run" : options.temporaryPrefix;
+    const auto sortedPath = prefix + ".out";
+
+    // MergeSort needs a scratch buffer of half the chunk
+    const auto chunkRecords = std::max<std::size_t>(
+      options.isStable ? 2 * options.memoryBudget / (3 * sizeof(T)) : options.memoryBudget / sizeof(T), 1);
+    const auto bufferRecords = std::max<std::size_t>(options.bufferSize / sizeof(T), 1);
+
+    // Spill the sorted runs
+    std::vector<std::string> runs;
+    auto isFailed = false;
+    auto isSorted = false; // Whether the sorted temporary file is complete
+    {
+      ExternalFile<T> input(inputPath, "rb", 1, stats);
+      isFailed = input.IsFailed();
+      std::vector<T> chunk(isFailed ? 0 : chunkRecords);
+      std::vector<T> scratch;
+      while (!isFailed)
+      {
+        const auto size = input.Read(chunk.data(), chunk.size());
+        stats.records += size;
+        isFailed = input.IsFailed();
+        if (isFailed || (size == 0 && !runs.empty()))
+          break;
+
+        if (options.isStable)
+          MergeSortWithScratch<T*, Compare>(chunk.data(), chunk.data() + size, scratch);
+        else
+          QuickSort<T*, Compare>(chunk.data(), chunk.data() + size);
+
+        // The whole input fits within a single chunk: no run to be merged
+        const auto isLast = size < chunk.size();
+        const auto isOutput = isLast && runs.empty();
+        if (isLast)
+          input.Close();
+
+        const auto path = isOutput ? sortedPath : prefix + std::to_string(runs.size());
+        ExternalFile<T> run(path, "wb", 1, stats);
+        run.Write(chunk.data(), size);
+        isFailed = !run.Close();
+        if (isOutput)
+        {
+          stats.mergedRecords = size;
+          isSorted = !isFailed;
+          isFailed = isFailed || !ExternalReplace(sortedPath, outputPath);
+        }
+        else
+        {
+          runs.push_back(path);
+          ++stats.runs;
+        }
+
+        if (options.progress)
+          options.progress(stats);
+        if (isLast)
+          break;
+      }
+    }
+
+    // Merge the runs by groups fitting the memory budget: one buffer per run and one output buffer
+    const auto fanIn = std::max<std::size_t>(options.memoryBudget / (bufferRecords * sizeof(T)), 3) - 1;
+    std::vector<std::string> merged;
+    while (!isFailed && !runs.empty())
+    {
+      ++stats.mergePass;
+      stats.mergedRecords = 0;
+      const auto isFinal = runs.size() <= fanIn;
+      for (std::size_t first = 0; first < runs.size() && !isFailed; first += fanIn)
+      {
+        const std::vector<std::string> group(runs.begin() + first,
+                                             runs.begin() + std::min(first + fanIn, runs.size()));
+        const auto path = isFinal ? sortedPath : prefix + std::to_string(stats.runs + merged.size());
+        if (!isFinal)
+          merged.push_back(path);
+
+        // Runs are only removed once merged successfully
+        isFailed = !ExternalMergeRuns<T, Compare>(group, path, bufferRecords, stats, options.progress);
+        if (isFailed)
+          break;
+
+        for (std::size_t i = 0; i < group.size(); ++i)
+          std::remove(group[i].c_str());
+        isSorted = isFinal;
+        if (isFinal)
+          isFailed = !ExternalReplace(sortedPath, outputPath);
+      }
+
+      if (isFailed)
+        break;
+
+      runs.clear();
+      if (!isFinal)
+      {
+        stats.runs += merged.size();
+        runs.swap(merged);
+      }
+    }
+
+    // Remove the remaining temporary files on failure: the input is untouched, and the sorted records are
+    // kept if they could not be moved over the output
+    for (std::size_t i = 0; i < runs.size(); ++i)
+      std::remove(runs[i].c_str());
+    for (std::size_t i = 0; i < merged.size(); ++i)
+      std::remove(merged[i].c_str());
+    if (isFailed && !isSorted)
+      std::remove(sortedPath.c_str());
+
+    return !isFailed;
+  }
+}
+
+#endif // MODULE_SORT_EXTERNAL_HXX
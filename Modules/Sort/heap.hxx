@@ -0,0 +1,95 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_HEAP_HXX
+#define MODULE_SORT_HEAP_HXX
+
+// STD includes
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace SHA_Sort
+{
+  /// SiftDown - Move down the element at index root until the sub-tree it heads respects the heap property.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less for a max-heap, std::greater for a min-heap).
+  ///
+  /// @param begin iterator to the first element of the heap.
+  /// @param root index of the element to be moved down.
+  /// @param size number of elements contained within the heap.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void SiftDown(const IT& begin, int root, const int size)
+  {
+    for (auto child = 2 * root + 1; child < size; child = 2 * root + 1)
+    {
+      // Pick the greatest child given the comparator
+      if (child + 1 < size && Compare()(*(begin + child), *(begin + child + 1)))
+        ++child;
+
+      // Heap property restored
+      if (!Compare()(*(begin + root), *(begin + child)))
+        return;
+
+      std::swap(*(begin + root), *(begin + child));
+      root = child;
+    }
+  }
+
+  /// Heap Sort - Proceed an in-place sort on the elements.
+  /// Build a heap from the sequence and then repeatedly extract its root to the end of the sequence.
+  ///
+  /// @remark guaranteed O(N log N) with O(1) memory: used as fallback by hybrid sorts.
+  ///
+  /// @complexity O(N log N).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void HeapSort(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Build the heap from the last parent up to the root
+    for (auto root = distance / 2 - 1; root >= 0; --root)
+      SiftDown<IT, Compare>(begin, root, distance);
+
+    // Move the root at the end of the heap and restore the heap property on the remaining elements
+    for (auto last = distance - 1; last > 0; --last)
+    {
+      std::swap(*begin, *(begin + last));
+      SiftDown<IT, Compare>(begin, 0, last);
+    }
+  }
+}
+
+#endif // MODULE_SORT_HEAP_HXX
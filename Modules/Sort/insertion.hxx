@@ -0,0 +1,117 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_INSERTION_HXX
+#define MODULE_SORT_INSERTION_HXX
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace SHA_Sort
+{
+  /// Insertion Sort - Proceed an in-place sort on the elements.
+  /// Each element is moved backward until it reaches its place within the already sorted prefix.
+  ///
+  /// @remark very efficient on small or nearly sorted sequences: used as base case by hybrid sorts.
+  ///
+  /// @complexity O(N^2) in the worst case, O(N) on already sorted sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void InsertionSort(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    for (auto it = begin + 1; it < end; ++it)
+    {
+      // Shift the sorted prefix to the right until the hole reaches the value position
+      auto value = std::move(*it);
+      auto hole = it;
+      for (; hole != begin && Compare()(value, *(hole - 1)); --hole)
+        *hole = std::move(*(hole - 1));
+
+      *hole = std::move(value);
+    }
+  }
+
+  /// Binary Insertion Sort - Proceed a stable in-place sort on the elements, knowing that the first ones
+  /// are already sorted. The insertion position of each element is found using a binary search.
+  ///
+  /// @remark reduces the number of comparisons to O(N log N): efficient with expensive comparisons.
+  ///
+  /// @complexity O(N log N) comparisons, O(N^2) moves.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param sortedEnd iterator to the end of the already sorted sequence [begin, sortedEnd[.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void BinaryInsertionSort(const IT& begin, const IT& sortedEnd, const IT& end)
+  {
+    if (std::distance(begin, end) < 2 || std::distance(begin, sortedEnd) < 0)
+      return;
+
+    for (auto it = (begin == sortedEnd) ? begin + 1 : sortedEnd; it < end; ++it)
+    {
+      // Insert after the equivalent elements to keep the sort stable
+      const auto position = std::upper_bound(begin, it, *it, Compare());
+      auto value = std::move(*it);
+      std::move_backward(position, it, it + 1);
+      *position = std::move(value);
+    }
+  }
+
+  /// Binary Insertion Sort - Proceed a stable in-place sort on the elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void BinaryInsertionSort(const IT& begin, const IT& end)
+  {
+    BinaryInsertionSort<IT, Compare>(begin, begin, end);
+  }
+}
+
+#endif // MODULE_SORT_INSERTION_HXX
@@ -20,8 +20,16 @@
 #ifndef MODULE_SORT_MERGE_HXX
 #define MODULE_SORT_MERGE_HXX
 
+#include <insertion.hxx>
+#include <sorting_network.hxx>
+
 // STD includes
+#include <algorithm>
+#include <functional>
 #include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace SHA_Sort
 {
@@ -46,6 +54,8 @@ namespace SHA_Sort
   class MergeInPlace
   {
   public:
+    typedef Compare ValueCompare; ///< Functor type ordering the elements
+
     void operator()(const IT& begin, const IT& pivot, const IT& end)
     {
       if (std::distance(begin, pivot) < 1 || std::distance(pivot, end) < 1)
@@ -78,6 +88,8 @@ namespace SHA_Sort
   /// of elements contained in [begin, middle[ and [middle, end[ using intermediate buffer.
   ///
   /// @warning Both sequence [bengin, middle[ and [middle, end[ need to be ordered.
+  /// @warning Stable only with a non-strict functor (std::less_equal): on equivalence, the default std::less
+  /// takes the element of the second sequence first. Use MergeWithScratch or StableSort for a stable merge.
   ///
   /// @remark use MergeInPlace to proceed the merge in place:
   /// Takes lower memory consumption and higher computation consumption.
@@ -95,6 +107,8 @@ namespace SHA_Sort
   class MergeWithBuffer
   {
   public:
+    typedef Compare ValueCompare; ///< Functor type ordering the elements
+
     void operator()(IT begin, IT middle, IT end)
     {
       if (std::distance(begin, middle) < 1 || std::distance(middle, end) < 1)
@@ -128,7 +142,180 @@ namespace SHA_Sort
     }
   };
 
+  /// MergeWithRotations Functor - In-place stable merging of two ordered sequences of a collection
+  /// contained in [begin, middle[ and [middle, end[ using the SymMerge algorithm (Kim & Kutzner).
+  /// A binary search finds the symmetric split of both sequences around the middle of the whole one,
+  /// a rotation swaps the inner blocks and both halves are recursively merged.
+  ///
+  /// @warning Both sequence [bengin, middle[ and [middle, end[ need to be ordered.
+  ///
+  /// @remark use MergeWithBuffer or MergeWithScratch when memory is not constrained:
+  /// faster but requires O(N) extra memory.
+  ///
+  /// @complexity O(N log N) moves and O(M log(N / M + 1)) comparisons (M being the smallest sequence size),
+  /// O(1) extra memory and O(log N) stack.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,middle,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  class MergeWithRotations
+  {
+  public:
+    typedef Compare ValueCompare; ///< Functor type ordering the elements
+
+    void operator()(IT begin, IT middle, IT end)
+    {
+      const auto kMiddleIdx = static_cast<const int>(std::distance(begin, middle));
+      const auto kSize = static_cast<const int>(std::distance(begin, end));
+      if (kMiddleIdx < 1 || kSize - kMiddleIdx < 1)
+        return;
+
+      // Single element in the first sequence: rotate it before the first element not lower
+      if (kMiddleIdx == 1)
+      {
+        std::rotate(begin, middle, std::lower_bound(middle, end, *begin, Compare()));
+        return;
+      }
+
+      // Single element in the second sequence: rotate it after the last element not greater
+      if (kSize - kMiddleIdx == 1)
+      {
+        std::rotate(std::upper_bound(begin, middle, *middle, Compare()), middle, end);
+        return;
+      }
+
+      // Binary search of the symmetric split [start, n - start[ around the middle of the whole sequence
+      const auto kHalfIdx = kSize / 2;
+      const auto n = kHalfIdx + kMiddleIdx;
+      auto start = (kMiddleIdx > kHalfIdx) ? n - kSize : 0;
+      auto high = (kMiddleIdx > kHalfIdx) ? kHalfIdx : kMiddleIdx;
+      while (start < high)
+      {
+        const auto current = (start + high) / 2;
+        if (!Compare()(*(begin + (n - 1 - current)), *(begin + current)))
+          start = current + 1;
+        else
+          high = current;
+      }
+      const auto stop = n - start;
+
+      // Swap the inner blocks and merge both halves
+      if (start < kMiddleIdx && kMiddleIdx < stop)
+        std::rotate(begin + start, middle, begin + stop);
+      if (0 < start && start < kHalfIdx)
+        (*this)(begin, begin + start, begin + kHalfIdx);
+      if (kHalfIdx < stop && stop < kSize)
+        (*this)(begin + kHalfIdx, begin + stop, end);
+    }
+  };
+
+  /// MergeWithScratch Functor - Merging of two ordered sequences of a collection
+  /// of elements contained in [begin, middle[ and [middle, end[ using a caller-owned scratch buffer.
+  /// The first sequence is moved into the scratch buffer and merged back with the second one:
+  /// the buffer only needs to hold the first sequence and is reused from one merge to another.
+  ///
+  /// @warning Both sequence [bengin, middle[ and [middle, end[ need to be ordered.
+  ///
+  /// @remark the merge is stable: equivalent elements keep their relative order.
+  /// @remark no merge is proceeded if both sequences are already in order.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  class MergeWithScratch
+  {
+    typedef typename std::iterator_traits<IT>::value_type Value;
+
+  public:
+    typedef Compare ValueCompare; ///< Functor type ordering the elements
+    typedef typename std::vector<Value>::iterator ScratchIT; ///< Iterator type over a scratch buffer
+
+    /// Construct the aggregator over a scratch buffer, grown on demand if too small.
+    ///
+    /// @param scratch buffer used to store the first sequence, should outlive the aggregator.
+    explicit MergeWithScratch(std::vector<Value>& scratch) : scratch(&scratch), scratchBegin() {}
+
+    /// Construct the aggregator over a fixed-size scratch range, never grown.
+    ///
+    /// @warning the range should hold the biggest first sequence to be merged.
+    ///
+    /// @param scratchBegin iterator to the first element of the scratch range, should outlive the aggregator.
+    explicit MergeWithScratch(const ScratchIT& scratchBegin) : scratch(nullptr), scratchBegin(scratchBegin) {}
+
+    /// @param begin,middle,end iterators to the initial and final positions of
+    /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    ///
+    /// @return void.
+    void operator()(IT begin, IT middle, IT end)
+    {
+      const auto kLeftSize = static_cast<const int>(std::distance(begin, middle));
+      if (kLeftSize < 1 || std::distance(middle, end) < 1)
+        return;
+
+      // Sequences already in order
+      if (!Compare()(*middle, *(middle - 1)))
+        return;
+
+      auto buffIt = this->scratchBegin;
+      if (this->scratch)
+      {
+        if (this->scratch->size() < static_cast<size_t>(kLeftSize))
+          this->scratch->resize(kLeftSize);
+        buffIt = this->scratch->begin();
+      }
+
+      // Move the first sequence aside
+      const auto bufferEnd = std::move(begin, middle, buffIt);
+
+      // Merge back taking one by one the lowest element - first sequence first on equivalence
+      auto it = begin;
+      while (buffIt != bufferEnd && middle != end)
+      {
+        if (Compare()(*middle, *buffIt))
+          *it++ = std::move(*middle++);
+        else
+          *it++ = std::move(*buffIt++);
+      }
+
+      // Finish remaining elements of the first sequence (the second one is already in place)
+      std::move(buffIt, bufferEnd, it);
+    }
+
+  private:
+    std::vector<Value>* scratch; // Buffer receiving the first sequence, null on a fixed scratch range
+    ScratchIT scratchBegin;      // Fixed scratch range receiving the first sequence
+  };
+
+  /// Size under which MergeSort sorts arithmetic values through a sorting network (see TrySortingNetwork).
+  const int kMergeSortNetworkCutoff = 16;
+
+  /// Merge Aggregator Compare - Functor type ordering the elements of an aggregator, void if unknown.
+  ///
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  template <typename Aggregator, typename Enable = void>
+  struct MergeAggregatorCompare
+  {
+    typedef void Type;
+  };
+
+  template <typename Aggregator>
+  struct MergeAggregatorCompare<Aggregator,
+    typename std::conditional<true, void, typename Aggregator::ValueCompare>::type>
+  {
+    typedef typename Aggregator::ValueCompare Type;
+  };
+
   /// MergeSort - Proceed sort on the elements whether using an in-place strategy or using a buffer one.
+  /// Small sequences of arithmetic values ordered by a standard functor are sorted by a sorting network.
   ///
   /// @tparam IT type using to go through the collection.
   /// @tparam Aggregator functor type used to aggregate two sorted sequences.
@@ -146,6 +333,11 @@ namespace SHA_Sort
     if (ksize < 2)
       return;
 
+    // Small sequences of arithmetic values: stability is not observable, use a sorting network
+    if (ksize <= kMergeSortNetworkCutoff &&
+        TrySortingNetwork<IT, typename MergeAggregatorCompare<Aggregator>::Type>(begin, end))
+      return;
+
     auto pivot = begin + ksize / 2;
 
     // Recursively break the vector into two pieces
@@ -155,6 +347,208 @@ namespace SHA_Sort
     // Merge the two pieces
     Aggregator()(begin, pivot, end);
   }
+
+  /// MergeSort - Proceed sort on the elements using an aggregator instance, allowing the aggregator
+  /// to keep a state from one merge to another (e.g. MergeWithScratch buffer).
+  /// Small sequences of arithmetic values ordered by a standard functor are sorted by a sorting network.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param aggregator functor instance used for all the merges.
+  ///
+  /// @return void.
+  template <typename IT, typename Aggregator>
+  void MergeSort(const IT& begin, const IT& end, Aggregator& aggregator)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize < 2)
+      return;
+
+    // Small sequences of arithmetic values: stability is not observable, use a sorting network
+    if (ksize <= kMergeSortNetworkCutoff &&
+        TrySortingNetwork<IT, typename MergeAggregatorCompare<Aggregator>::Type>(begin, end))
+      return;
+
+    auto pivot = begin + ksize / 2;
+
+    // Recursively break the vector into two pieces
+    MergeSort<IT, Aggregator>(begin, pivot, aggregator);
+    MergeSort<IT, Aggregator>(pivot, end, aggregator);
+
+    // Merge the two pieces
+    aggregator(begin, pivot, end);
+  }
+
+  /// Size under which MergeSortWithScratch and StableSort sort the sequences using an insertion sort.
+  const int kStableSortInsertionCutoff = 16;
+
+  /// MergeSortWithScratch Loop - Top-down merge sort of the elements, merging through a shared scratch buffer
+  /// and sorting small sequences using a sorting network (arithmetic values) or an insertion sort.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param aggregator stable merge functor over the scratch buffer.
+  ///
+  /// @return void.
+  template <typename IT, typename Compare>
+  void MergeSortWithScratchLoop(const IT& begin, const IT& end, MergeWithScratch<IT, Compare>& aggregator)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize <= kStableSortInsertionCutoff)
+    {
+      // Stability is not observable on arithmetic values ordered by a standard functor
+      if (!TrySortingNetwork<IT, Compare>(begin, end))
+        InsertionSort<IT, Compare>(begin, end);
+      return;
+    }
+
+    auto pivot = begin + ksize / 2;
+    MergeSortWithScratchLoop<IT, Compare>(begin, pivot, aggregator);
+    MergeSortWithScratchLoop<IT, Compare>(pivot, end, aggregator);
+    aggregator(begin, pivot, end);
+  }
+
+  /// MergeSortWithScratch - Proceed a stable merge sort on the elements using a single scratch buffer
+  /// of N / 2 elements for all the merges: no allocation happens during the sort if the buffer is
+  /// already big enough.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param scratch buffer to be used by the merges, resized to N / 2 elements if smaller.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void MergeSortWithScratch(const IT& begin, const IT& end,
+                            std::vector<typename std::iterator_traits<IT>::value_type>& scratch)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize < 2)
+      return;
+
+    // The biggest first sequence to be merged is the first half of the whole sequence
+    if (scratch.size() < static_cast<size_t>(ksize / 2))
+      scratch.resize(ksize / 2);
+
+    MergeWithScratch<IT, Compare> aggregator(scratch.begin());
+    MergeSortWithScratchLoop<IT, Compare>(begin, end, aggregator);
+  }
+
+  /// MergeSortWithScratch - Proceed a stable merge sort on the elements using a caller-owned scratch range
+  /// of at least N / 2 elements for all the merges: no allocation happens during the sort.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param scratchBegin iterator to the first element of a scratch range of at least N / 2 elements.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void MergeSortWithScratch(const IT& begin, const IT& end,
+    const typename MergeWithScratch<IT, Compare>::ScratchIT& scratchBegin)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    MergeWithScratch<IT, Compare> aggregator(scratchBegin);
+    MergeSortWithScratchLoop<IT, Compare>(begin, end, aggregator);
+  }
+
+  /// MergeSortWithScratch - Proceed a stable merge sort on the elements allocating a single scratch buffer
+  /// of N / 2 elements for all the merges.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void MergeSortWithScratch(const IT& begin, const IT& end)
+  {
+    std::vector<typename std::iterator_traits<IT>::value_type> scratch;
+    MergeSortWithScratch<IT, Compare>(begin, end, scratch);
+  }
+
+  /// Stable Sort - Proceed a stable sort on the elements: equivalent elements keep their relative order,
+  /// so that sorting by a secondary key then by a primary key orders by both keys.
+  /// Merges move the first sequence into a scratch buffer of N / 2 elements and take it first on equivalence
+  /// (see MergeSortWithScratch).
+  ///
+  /// @complexity O(N log N) comparisons and moves, O(N) extra memory.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param scratch buffer to be used by the merges, resized to N / 2 elements if smaller.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void StableSort(const IT& begin, const IT& end,
+                  std::vector<typename std::iterator_traits<IT>::value_type>& scratch)
+  {
+    MergeSortWithScratch<IT, Compare>(begin, end, scratch);
+  }
+
+  /// Stable Sort - Proceed a stable sort on the elements using a caller-owned scratch range: no allocation.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param scratchBegin iterator to the first element of a scratch range of at least N / 2 elements.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void StableSort(const IT& begin, const IT& end,
+                  const typename MergeWithScratch<IT, Compare>::ScratchIT& scratchBegin)
+  {
+    MergeSortWithScratch<IT, Compare>(begin, end, scratchBegin);
+  }
+
+  /// Stable Sort - Proceed a stable sort on the elements allocating a scratch buffer of N / 2 elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void StableSort(const IT& begin, const IT& end)
+  {
+    std::vector<typename std::iterator_traits<IT>::value_type> scratch;
+    StableSort<IT, Compare>(begin, end, scratch);
+  }
 }
 
 #endif // MODULE_SORT_MERGE_HXX
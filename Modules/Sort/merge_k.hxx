@@ -0,0 +1,377 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_MERGE_K_HXX
+#define MODULE_SORT_MERGE_K_HXX
+
+#include <insertion.hxx>
+#include <merge.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// Loser Tree - Tournament tree selecting the smallest head among k sequences in O(log k) comparisons
+  /// per element: each internal node keeps the loser of its match, the overall winner being kept apart.
+  /// Ties are won by the sequence with the smallest index: merges are stable.
+  /// Nodes carry the head values next to their sequence index in a flat array allocated once: replaying
+  /// a match touches a single node per level, no allocation happens per element, and Reset reuses the
+  /// nodes from one merge to another.
+  ///
+  /// @tparam T type of the heads.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  template <typename T,
+            typename Compare = std::less<T>>
+  class LoserTree
+  {
+  public:
+    /// Construct a tree over count sequences, all exhausted until Set is called.
+    explicit LoserTree(const std::size_t count = 0) { Reset(count); }
+
+    /// Reset the tree over count sequences, all exhausted until Set is called.
+    void Reset(const std::size_t count)
+    {
+      this->count = count;
+      this->nodes.resize(std::max<std::size_t>(count, 1));
+      this->heads.resize(count);
+      this->isExhausted.assign(count, true);
+    }
+
+    /// Set the head of a sequence before the tree is built.
+    void Set(const std::size_t source, T value)
+    {
+      this->heads[source] = std::move(value);
+      this->isExhausted[source] = false;
+    }
+
+    /// Play all the matches once the heads of the sequences are set.
+    void Build()
+    {
+      if (this->count == 0)
+        return;
+
+      // Leaves are the nodes [count, 2 * count[, the winner of the node i plays within the node i / 2
+      this->winners.resize(2 * this->count);
+      for (std::size_t i = 0; i < this->count; ++i)
+        this->winners[this->count + i] = i;
+      for (std::size_t node = this->count - 1; node > 0; --node)
+      {
+        const auto a = this->winners[2 * node];
+        const auto b = this->winners[2 * node + 1];
+        const auto isWon = Beats(a, b);
+        this->winners[node] = isWon ? a : b;
+        this->nodes[node].source = isWon ? b : a;
+      }
+      this->nodes[0].source = this->winners[1];
+
+      for (std::size_t node = 0; node < this->count; ++node)
+        this->nodes[node].value = std::move(this->heads[this->nodes[node].source]);
+    }
+
+    /// Whether all the sequences are exhausted.
+    bool IsEmpty() const { return this->count == 0 || this->isExhausted[this->nodes[0].source]; }
+
+    /// Index of the sequence holding the smallest head.
+    std::size_t Winner() const { return this->nodes[0].source; }
+
+    /// Smallest head, may be moved from before calling Replace or Exhaust.
+    T& Top() { return this->nodes[0].value; }
+    const T& Top() const { return this->nodes[0].value; }
+
+    /// Replace the smallest head by the next value of its sequence.
+    void Replace(T value)
+    {
+      this->nodes[0].value = std::move(value);
+      Replay();
+    }
+
+    /// Remove the sequence holding the smallest head, once exhausted.
+    void Exhaust()
+    {
+      this->isExhausted[this->nodes[0].source] = true;
+      Replay();
+    }
+
+  private:
+    struct Node
+    {
+      T value;            // Head of the sequence
+      std::size_t source; // Index of the sequence
+    };
+
+    /// Whether the head of the sequence a wins against the head of the sequence b while building.
+    bool Beats(const std::size_t a, const std::size_t b) const
+    {
+      if (this->isExhausted[a] || this->isExhausted[b])
+        return !this->isExhausted[a] && (this->isExhausted[b] || a < b);
+      return (a < b) ? !Compare()(this->heads[b], this->heads[a]) : Compare()(this->heads[a], this->heads[b]);
+    }
+
+    /// Replay the matches of the winner node from its leaf up to the root, the winner being kept aside.
+    void Replay()
+    {
+      auto winner = this->nodes[0].source;
+      auto value = std::move(this->nodes[0].value);
+      auto isWinnerExhausted = this->isExhausted[winner] != 0;
+      for (auto node = (this->count + winner) / 2; node > 0; node /= 2)
+      {
+        // An exhausted sequence never wins, ties are won by the smallest index: matches being
+        // unpredictable, they are played through bitwise operators and selects rather than branches
+        auto& loser = this->nodes[node];
+        const bool isLess = Compare()(loser.value, value);
+        const bool isLessEqual = !Compare()(value, loser.value);
+        const bool isFirst = loser.source < winner;
+        const bool isLost = (this->isExhausted[loser.source] == 0) &
+          (isWinnerExhausted | (isFirst & isLessEqual) | (!isFirst & isLess));
+        isWinnerExhausted = isWinnerExhausted & !isLost;
+        LoserTreeExchange(isLost, loser.source, winner, std::true_type());
+        LoserTreeExchange(isLost, loser.value, value, std::is_arithmetic<T>());
+      }
+
+      this->nodes[0].source = winner;
+      this->nodes[0].value = std::move(value);
+    }
+
+    /// Exchange of arithmetic values through selects.
+    template <typename V>
+    static void LoserTreeExchange(const bool isExchanged, V& a, V& b, std::true_type)
+    {
+      const auto first = a;
+      a = isExchanged ? b : first;
+      b = isExchanged ? first : b;
+    }
+
+    /// Exchange of generic values.
+    template <typename V>
+    static void LoserTreeExchange(const bool isExchanged, V& a, V& b, std::false_type)
+    {
+      if (isExchanged)
+        std::swap(a, b);
+    }
+
+    std::size_t count;                // Number of sequences
+    std::vector<Node> nodes;          // Loser of each internal node, overall winner at index 0
+    std::vector<T> heads;             // Heads of the sequences while building
+    std::vector<std::size_t> winners; // Winner of each node while building
+    std::vector<char> isExhausted;    // Whether each sequence is over
+  };
+
+  /// MergeK - Stable k-way merge of sorted sequences into an output sequence through a loser tree:
+  /// elements are moved from the ranges into the tree then to the output.
+  /// The tree is reset over the ranges: reusing it avoids any allocation from one merge to another.
+  ///
+  /// @complexity O(N log k) comparisons, N being the total number of elements.
+  ///
+  /// @tparam IT type using to go through the collections.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam OutputIT type of the output iterator (deduced).
+  ///
+  /// @param ranges [begin, end[ pairs of the sorted sequences to be merged: on equivalence, elements of the
+  /// first sequences come first.
+  /// @param output iterator to the initial position of the merged sequence (should not overlap the ranges).
+  /// @param tree loser tree reset over the ranges.
+  ///
+  /// @return iterator to the end of the merged sequence.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename OutputIT>
+  OutputIT MergeK(const std::vector<std::pair<IT, IT>>& ranges, OutputIT output,
+                  LoserTree<typename std::iterator_traits<IT>::value_type, Compare>& tree)
+  {
+    tree.Reset(ranges.size());
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+      if (ranges[i].first != ranges[i].second)
+        tree.Set(i, std::move(*ranges[i].first));
+    tree.Build();
+
+    // Next element of each range once its head is in the tree
+    std::vector<IT> nexts;
+    nexts.reserve(ranges.size());
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+      nexts.push_back(ranges[i].first == ranges[i].second ? ranges[i].second : std::next(ranges[i].first));
+
+    while (!tree.IsEmpty())
+    {
+      const auto source = tree.Winner();
+      *output++ = std::move(tree.Top());
+      if (nexts[source] != ranges[source].second)
+        tree.Replace(std::move(*nexts[source]++));
+      else
+        tree.Exhaust();
+    }
+
+    return output;
+  }
+
+  /// MergeK - Stable k-way merge of sorted sequences into an output sequence through a loser tree.
+  ///
+  /// @complexity O(N log k) comparisons, N being the total number of elements.
+  ///
+  /// @tparam IT type using to go through the collections.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam OutputIT type of the output iterator (deduced).
+  ///
+  /// @param ranges [begin, end[ pairs of the sorted sequences to be merged: on equivalence, elements of the
+  /// first sequences come first.
+  /// @param output iterator to the initial position of the merged sequence (should not overlap the ranges).
+  ///
+  /// @return iterator to the end of the merged sequence.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename OutputIT>
+  OutputIT MergeK(const std::vector<std::pair<IT, IT>>& ranges, OutputIT output)
+  {
+    LoserTree<typename std::iterator_traits<IT>::value_type, Compare> tree(ranges.size());
+    return MergeK<IT, Compare>(ranges, output, tree);
+  }
+
+  /// Default number of sequences merged at once by the MultiwayMergeSort.
+  const int kMergeKWays = 8;
+
+  /// MergeKWithBuffer Functor - Stable k-way merge of consecutive sorted sequences of a collection
+  /// through a loser tree and a buffer, both reused from one merge to another.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  class MergeKWithBuffer
+  {
+    typedef typename std::iterator_traits<IT>::value_type Value;
+
+  public:
+    typedef Compare ValueCompare; ///< Functor type ordering the elements
+
+    /// @param ways maximal number of sequences merged at once (at least 2).
+    explicit MergeKWithBuffer(const int ways = kMergeKWays) : ways(std::max(ways, 2)) {}
+
+    /// Maximal number of sequences merged at once.
+    int Ways() const { return this->ways; }
+
+    /// @param bounds iterators to the positions delimiting the sequences [bounds[i], bounds[i + 1][,
+    /// from the beginning to the end of the whole sequence.
+    ///
+    /// @return void.
+    void operator()(const std::vector<IT>& bounds)
+    {
+      if (bounds.size() < 3)
+        return;
+
+      // Sequences already in order: each first element is not lower than the last one of the sequence before
+      auto isOrdered = true;
+      auto last = bounds.front();
+      for (std::size_t i = 0; i + 1 < bounds.size() && isOrdered; ++i)
+      {
+        if (bounds[i] == bounds[i + 1])
+          continue;
+        isOrdered = last == bounds.front() || !Compare()(*bounds[i], *(last - 1));
+        last = bounds[i + 1];
+      }
+      if (isOrdered)
+        return;
+
+      this->ranges.clear();
+      for (std::size_t i = 0; i + 1 < bounds.size(); ++i)
+        this->ranges.push_back(std::make_pair(bounds[i], bounds[i + 1]));
+
+      const auto size = static_cast<std::size_t>(std::distance(bounds.front(), bounds.back()));
+      if (this->buffer.size() < size)
+        this->buffer.resize(size);
+      const auto bufferEnd = MergeK<IT, Compare>(this->ranges, this->buffer.begin(), this->tree);
+      std::move(this->buffer.begin(), bufferEnd, bounds.front());
+    }
+
+  private:
+    int ways;                                        // Maximal number of sequences merged at once
+    std::vector<std::pair<IT, IT>> ranges;           // Sequences being merged
+    std::vector<Value> buffer;                       // Merged sequence
+    LoserTree<typename std::iterator_traits<IT>::value_type, Compare> tree;  // Tournament over the heads of the sequences
+  };
+
+  /// MultiwayMergeSort - Proceed a stable merge sort splitting the sequence into k sub-sequences at each
+  /// level, merged at once by a k-way aggregator: log_k(N) passes over the elements instead of log_2(N).
+  /// Small sequences are sorted by a sorting network (arithmetic values) or an insertion sort.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Aggregator functor type used to aggregate k consecutive sorted sequences.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param aggregator functor instance used for all the merges.
+  ///
+  /// @return void.
+  template <typename IT, typename Aggregator>
+  void MultiwayMergeSort(const IT& begin, const IT& end, Aggregator& aggregator)
+  {
+    typedef typename Aggregator::ValueCompare Compare;
+
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize < 2)
+      return;
+
+    if (ksize <= kMergeSortNetworkCutoff)
+    {
+      if (!TrySortingNetwork<IT, Compare>(begin, end))
+        InsertionSort<IT, Compare>(begin, end);
+      return;
+    }
+
+    // Recursively sort ways sub-sequences of (almost) equal sizes
+    const auto ways = std::min(aggregator.Ways(), ksize);
+    std::vector<IT> bounds(1, begin);
+    for (int i = 1; i <= ways; ++i)
+    {
+      const auto first = bounds.back();
+      bounds.push_back(begin + static_cast<int>(static_cast<long long>(ksize) * i / ways));
+      MultiwayMergeSort<IT, Aggregator>(first, bounds.back(), aggregator);
+    }
+
+    // Merge them at once
+    aggregator(bounds);
+  }
+
+  /// MultiwayMergeSort - Proceed a stable k-way merge sort on the elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param ways number of sub-sequences merged at once.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void MultiwayMergeSort(const IT& begin, const IT& end, const int ways = kMergeKWays)
+  {
+    MergeKWithBuffer<IT, Compare> aggregator(ways);
+    MultiwayMergeSort<IT, MergeKWithBuffer<IT, Compare>>(begin, end, aggregator);
+  }
+}
+
+#endif // MODULE_SORT_MERGE_K_HXX
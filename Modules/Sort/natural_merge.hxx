@@ -0,0 +1,337 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_NATURAL_MERGE_HXX
+#define MODULE_SORT_NATURAL_MERGE_HXX
+
+#include <insertion.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// Number of consecutive wins of a sequence after which MergeWithGallop enters galloping mode.
+  const int kMinGallop = 7;
+
+  /// Gallop Lower Bound - Find the first element not lower than the value, probing exponentially
+  /// growing steps from the beginning before a binary search within the last step.
+  ///
+  /// @remark O(log k) comparisons with k the position found: much faster than a binary search
+  /// when the position is close to the beginning.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of the sorted sequence.
+  /// @param value value to be positioned.
+  ///
+  /// @return iterator to the first element not lower than the value, end if none.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT GallopLowerBound(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& value)
+  {
+    typedef typename std::iterator_traits<IT>::difference_type Distance;
+    const Distance size = std::distance(begin, end);
+    Distance low = 0;
+    Distance high = 1;
+
+    // [begin, begin + low[ elements are lower than the value
+    while (high <= size && Compare()(*(begin + (high - 1)), value))
+    {
+      low = high;
+      high *= 2;
+    }
+
+    return std::lower_bound(begin + low, begin + std::min(high, size), value, Compare());
+  }
+
+  /// Gallop Upper Bound - Find the first element greater than the value, probing exponentially
+  /// growing steps from the beginning before a binary search within the last step.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of the sorted sequence.
+  /// @param value value to be positioned.
+  ///
+  /// @return iterator to the first element greater than the value, end if none.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT GallopUpperBound(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& value)
+  {
+    typedef typename std::iterator_traits<IT>::difference_type Distance;
+    const Distance size = std::distance(begin, end);
+    Distance low = 0;
+    Distance high = 1;
+
+    // [begin, begin + low[ elements are not greater than the value
+    while (high <= size && !Compare()(value, *(begin + (high - 1))))
+    {
+      low = high;
+      high *= 2;
+    }
+
+    return std::upper_bound(begin + low, begin + std::min(high, size), value, Compare());
+  }
+
+  /// MergeWithGallop Functor - Stable merging of two ordered sequences of a collection
+  /// of elements contained in [begin, middle[ and [middle, end[ (TimSort merge).
+  /// - The parts of both sequences already in place are trimmed by galloping before merging.
+  /// - The first sequence is moved into a scratch buffer owned by the functor and reused from one merge
+  ///   to another.
+  /// - Once a sequence wins kMinGallop times in a row, whole blocks are moved at once by galloping.
+  ///
+  /// @warning Both sequence [bengin, middle[ and [middle, end[ need to be ordered.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  class MergeWithGallop
+  {
+    typedef typename std::iterator_traits<IT>::value_type Value;
+
+  public:
+    MergeWithGallop() : minGallop(kMinGallop) {}
+
+    /// @param begin,middle,end iterators to the initial and final positions of
+    /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    ///
+    /// @return void.
+    void operator()(IT begin, IT middle, IT end)
+    {
+      if (std::distance(begin, middle) < 1 || std::distance(middle, end) < 1)
+        return;
+
+      // Elements of the first sequence lower or equal to the second sequence first element are in place
+      begin = GallopUpperBound<IT, Compare>(begin, middle, *middle);
+      if (begin == middle)
+        return;
+
+      // Elements of the second sequence greater or equal to the first sequence last element are in place
+      end = std::lower_bound(middle, end, *(middle - 1), Compare());
+
+      // Move the first sequence aside
+      const auto kLeftSize = static_cast<size_t>(std::distance(begin, middle));
+      if (this->scratch.size() < kLeftSize)
+        this->scratch.resize(kLeftSize);
+      const auto bufferEnd = std::move(begin, middle, this->scratch.begin());
+      auto buffIt = this->scratch.begin();
+
+      // The first element of the second sequence is known to be the lowest one
+      auto it = begin;
+      *it++ = std::move(*middle++);
+
+      while (buffIt != bufferEnd && middle != end)
+      {
+        // One element at a time until a sequence wins too often
+        int leftWins = 0, rightWins = 0;
+        do
+        {
+          if (Compare()(*middle, *buffIt))
+          {
+            *it++ = std::move(*middle++);
+            ++rightWins;
+            leftWins = 0;
+          }
+          else
+          {
+            *it++ = std::move(*buffIt++);
+            ++leftWins;
+            rightWins = 0;
+          }
+        } while (buffIt != bufferEnd && middle != end && std::max(leftWins, rightWins) < this->minGallop);
+
+        // Galloping mode - move whole blocks while it pays off
+        while (buffIt != bufferEnd && middle != end)
+        {
+          const auto buffStop = GallopUpperBound<decltype(buffIt), Compare>(buffIt, bufferEnd, *middle);
+          leftWins = static_cast<int>(std::distance(buffIt, buffStop));
+          it = std::move(buffIt, buffStop, it);
+          buffIt = buffStop;
+          if (buffIt == bufferEnd)
+            break;
+
+          const auto middleStop = GallopLowerBound<IT, Compare>(middle, end, *buffIt);
+          rightWins = static_cast<int>(std::distance(middle, middleStop));
+          it = std::move(middle, middleStop, it);
+          middle = middleStop;
+
+          // Galloping is rewarded by lowering the threshold, penalized otherwise
+          if (leftWins < kMinGallop && rightWins < kMinGallop)
+          {
+            ++this->minGallop;
+            break;
+          }
+          this->minGallop = std::max(1, this->minGallop - 1);
+        }
+      }
+
+      // Finish remaining elements of the first sequence (the second one is already in place)
+      std::move(buffIt, bufferEnd, it);
+    }
+
+  private:
+    std::vector<Value> scratch; // Buffer receiving the first sequence
+    int minGallop;              // Adaptive galloping threshold
+  };
+
+  /// Compute the minimal run length used by NaturalMergeSort: a value within [16, 32] such that
+  /// N / minRun is equal to or slightly lower than a power of two, balancing the final merges.
+  ///
+  /// @param size number of elements to be sorted.
+  ///
+  /// @return minimal run length.
+  inline int NaturalMergeMinRun(int size)
+  {
+    auto hasRemainder = 0;
+    while (size >= 32)
+    {
+      hasRemainder |= size & 1;
+      size >>= 1;
+    }
+
+    return size + hasRemainder;
+  }
+
+  /// Natural MergeSort (TimSort) - Proceed a stable bottom-up sort on the elements, taking advantage of
+  /// the runs already ordered within the sequence.
+  /// - Ascending and strictly descending (reversed) runs are detected.
+  /// - Runs shorter than a minimal length are extended using a binary insertion sort.
+  /// - Runs are merged as soon as pushed, keeping a balanced merge tree, using the aggregator instance.
+  ///
+  /// @complexity O(N log N) in the worst case, O(N) on nearly sorted sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param aggregator functor instance used for all the merges.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename Aggregator = MergeWithGallop<IT, Compare>>
+  void NaturalMergeSort(const IT& begin, const IT& end, Aggregator& aggregator)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize < 2)
+      return;
+
+    const auto kMinRun = NaturalMergeMinRun(ksize);
+    std::vector<std::pair<IT, IT>> runs; // Stack of runs pending to be merged
+
+    // Merge the runs at index i and i + 1 of the stack
+    auto mergeAt = [&runs, &aggregator](size_t i)
+    {
+      aggregator(runs[i].first, runs[i].second, runs[i + 1].second);
+      runs[i].second = runs[i + 1].second;
+      runs.erase(runs.begin() + i + 1);
+    };
+    auto length = [&runs](size_t i) { return std::distance(runs[i].first, runs[i].second); };
+
+    for (auto runBegin = begin; runBegin != end;)
+    {
+      // Find the next run - reverse it if strictly descending (keeping the sort stable)
+      auto runEnd = runBegin + 1;
+      if (runEnd != end)
+      {
+        if (Compare()(*runEnd++, *runBegin))
+        {
+          while (runEnd != end && Compare()(*runEnd, *(runEnd - 1)))
+            ++runEnd;
+          std::reverse(runBegin, runEnd);
+        }
+        else
+          while (runEnd != end && !Compare()(*runEnd, *(runEnd - 1)))
+            ++runEnd;
+      }
+
+      // Extend short runs up to the minimal run length
+      const auto kSortedEnd = runEnd;
+      if (std::distance(runBegin, runEnd) < kMinRun)
+      {
+        runEnd = runBegin + std::min(kMinRun, static_cast<int>(std::distance(runBegin, end)));
+        BinaryInsertionSort<IT, Compare>(runBegin, kSortedEnd, runEnd);
+      }
+
+      // Push the run and merge until the stack invariants hold again:
+      // length(i - 2) > length(i - 1) + length(i) and length(i - 1) > length(i)
+      runs.push_back(std::make_pair(runBegin, runEnd));
+      while (runs.size() > 1)
+      {
+        auto n = runs.size() - 2;
+        if ((n > 0 && length(n - 1) <= length(n) + length(n + 1)) ||
+            (n > 1 && length(n - 2) <= length(n - 1) + length(n)))
+        {
+          if (length(n - 1) < length(n + 1))
+            --n;
+        }
+        else if (length(n) > length(n + 1))
+          break;
+
+        mergeAt(n);
+      }
+
+      runBegin = runEnd;
+    }
+
+    // Merge all the remaining runs
+    while (runs.size() > 1)
+    {
+      auto n = runs.size() - 2;
+      if (n > 0 && length(n - 1) < length(n + 1))
+        --n;
+      mergeAt(n);
+    }
+  }
+
+  /// Natural MergeSort (TimSort) - Proceed a stable bottom-up sort on the elements, taking advantage of
+  /// the runs already ordered within the sequence.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences, a single instance is used
+  /// for all the merges.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename Aggregator = MergeWithGallop<IT, Compare>>
+  void NaturalMergeSort(const IT& begin, const IT& end)
+  {
+    Aggregator aggregator;
+    NaturalMergeSort<IT, Compare, Aggregator>(begin, end, aggregator);
+  }
+}
+
+#endif // MODULE_SORT_NATURAL_MERGE_HXX
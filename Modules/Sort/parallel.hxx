@@ -0,0 +1,602 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PARALLEL_HXX
+#define MODULE_SORT_PARALLEL_HXX
+
+#include <bubble.hxx>
+#include <merge.hxx>
+#include <quick.hxx>
+#include <raddix.hxx>
+#include <thread_pool.hxx>
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// Default size under which parallel sorts process a sequence sequentially.
+  const int kParallelSortGrainSize = 1 << 14;
+
+  /// Parallel Sort Worker Count - Number of pool threads so that a sort runs on threadCount threads,
+  /// the calling one included as it runs pending tasks while waiting: at least one worker is created.
+  ///
+  /// @param threadCount number of threads running the sort, including the calling one.
+  ///
+  /// @return number of threads of the pool to be created.
+  inline unsigned int ParallelSortWorkerCount(const unsigned int threadCount)
+  {
+    return std::max(threadCount, 2u) - 1;
+  }
+
+  /// Parallel IntroSort Loop - Same partitioning as IntroSortLoop, forking the smallest partition on the
+  /// pool while the current thread carries on with the biggest one.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Pivot pivot selection policy (see AdaptivePivot).
+  ///
+  /// @param group task group collecting the forked partitions.
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depthLimit number of partitioning levels allowed before switching to heap sort.
+  /// @param insertionCutoff size under which the sequence is sorted using an insertion sort.
+  /// @param grainSize size under which the sequence is sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void ParallelIntroSortLoop(TaskGroup& group, IT begin, IT end, int depthLimit,
+                             const int insertionCutoff, const int grainSize)
+  {
+    while (std::distance(begin, end) > grainSize)
+    {
+      // Too many unbalanced partitions: guarantee O(N log N) on the remaining elements
+      if (depthLimit-- <= 0)
+      {
+        HeapSort<IT, Compare>(begin, end);
+        return;
+      }
+
+      auto pivot = Pivot::template Select<IT, Compare>(begin, end);  // Median of three / Ninther by default
+      auto newPivot = Partition<IT, Compare>(begin, pivot, end);     // Proceed partition
+
+      // Fork the smallest partition, loop on the biggest one
+      auto forkBegin = begin;
+      auto forkEnd = newPivot;
+      if (std::distance(begin, newPivot) < std::distance(newPivot + 1, end))
+        begin = newPivot + 1;
+      else
+      {
+        forkBegin = newPivot + 1;
+        forkEnd = end;
+        end = newPivot;
+      }
+
+      group.Run([&group, forkBegin, forkEnd, depthLimit, insertionCutoff, grainSize]()
+        { ParallelIntroSortLoop<IT, Compare, Pivot>(group, forkBegin, forkEnd, depthLimit, insertionCutoff, grainSize); });
+    }
+
+    IntroSortLoop<IT, Compare, Pivot>(begin, end, depthLimit, insertionCutoff);
+  }
+
+  /// Parallel Quick Sort - Proceed an in-place sort on the elements using a work-stealing thread pool.
+  /// Partitions are processed exactly as within QuickSort: the result is identical to the sequential one
+  /// (but with RandomPivot, whose generators are per thread).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Pivot pivot selection policy (see QuickSort).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pool thread pool running the forked partitions.
+  /// @param grainSize size under which partitions are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void ParallelQuickSort(const IT& begin, const IT& end, ThreadPool& pool,
+                         const int grainSize = kParallelSortGrainSize)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Depth limit set to 2 * floor(log2(N))
+    auto depthLimit = 0;
+    for (auto size = distance; size > 1; size >>= 1)
+      depthLimit += 2;
+
+    // Partitions smaller than the insertion cutoff must be left to the sequential loop
+    TaskGroup group(pool);
+    ParallelIntroSortLoop<IT, Compare, Pivot>(group, begin, end, depthLimit, kQuickSortInsertionCutoff,
+                                              std::max(grainSize, kQuickSortInsertionCutoff));
+    group.Wait();
+  }
+
+  /// Parallel Quick Sort - Proceed an in-place sort on the elements using a dedicated thread pool.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Pivot pivot selection policy (see QuickSort).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param threadCount number of threads running the sort, including the calling one (at least two).
+  /// @param grainSize size under which partitions are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void ParallelQuickSort(const IT& begin, const IT& end,
+                         const unsigned int threadCount = std::thread::hardware_concurrency(),
+                         const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    ThreadPool pool(ParallelSortWorkerCount(threadCount));
+    ParallelQuickSort<IT, Compare, Pivot>(begin, end, pool, grainSize);
+  }
+
+  /// Parallel MergeSort Recursion - Fork the sort of the first half on the pool, sort the second half
+  /// and merge both once joined.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  ///
+  /// @param pool thread pool running the forked halves.
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param grainSize size under which the sequence is sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Aggregator = MergeWithBuffer<IT>>
+  void ParallelMergeSortRecursion(ThreadPool& pool, const IT& begin, const IT& end, const int grainSize)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize <= grainSize)
+    {
+      MergeSort<IT, Aggregator>(begin, end);
+      return;
+    }
+
+    auto pivot = begin + ksize / 2;
+
+    // Sort both halves concurrently
+    TaskGroup group(pool);
+    group.Run([&pool, begin, pivot, grainSize]()
+      { ParallelMergeSortRecursion<IT, Aggregator>(pool, begin, pivot, grainSize); });
+    ParallelMergeSortRecursion<IT, Aggregator>(pool, pivot, end, grainSize);
+    group.Wait();
+
+    // Merge the two pieces
+    Aggregator()(begin, pivot, end);
+  }
+
+  /// Parallel MergeSort - Proceed sort on the elements using a work-stealing thread pool.
+  /// Sequences are split and merged exactly as within MergeSort: the result is identical to the sequential one.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pool thread pool running the forked halves.
+  /// @param grainSize size under which halves are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Aggregator = MergeWithBuffer<IT>>
+  void ParallelMergeSort(const IT& begin, const IT& end, ThreadPool& pool,
+                         const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    ParallelMergeSortRecursion<IT, Aggregator>(pool, begin, end, std::max(grainSize, 1));
+  }
+
+  /// Parallel MergeSort - Proceed sort on the elements using a dedicated thread pool.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Aggregator functor type used to aggregate two sorted sequences.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param threadCount number of threads running the sort, including the calling one (at least two).
+  /// @param grainSize size under which halves are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Aggregator = MergeWithBuffer<IT>>
+  void ParallelMergeSort(const IT& begin, const IT& end,
+                         const unsigned int threadCount = std::thread::hardware_concurrency(),
+                         const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    ThreadPool pool(ParallelSortWorkerCount(threadCount));
+    ParallelMergeSort<IT, Aggregator>(begin, end, pool, grainSize);
+  }
+
+  /// Parallel Stable Merge Loop - Stable merge of two sorted sequences into an output sequence, splitting the
+  /// biggest sequence at its middle and the other one at the matching bound so that both halves of the
+  /// merge are independent: the first half is forked on the pool while the current thread carries on.
+  ///
+  /// @tparam IT type using to go through the sequences.
+  /// @tparam OutputIT type of the output iterator.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param group task group collecting the forked halves.
+  /// @param first1,last1 first sorted sequence: taken first on equivalence.
+  /// @param first2,last2 second sorted sequence.
+  /// @param output iterator to the initial position of the merged sequence (should not overlap the inputs).
+  /// @param grainSize size under which the sequences are merged sequentially.
+  ///
+  /// @return void.
+  template <typename IT, typename OutputIT, typename Compare>
+  void ParallelStableMergeLoop(TaskGroup& group, IT first1, IT last1, IT first2, IT last2, OutputIT output,
+                               const int grainSize)
+  {
+    const auto size1 = std::distance(first1, last1);
+    const auto size2 = std::distance(first2, last2);
+    if (size1 + size2 <= grainSize || size1 == 0 || size2 == 0)
+    {
+      std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                 std::make_move_iterator(first2), std::make_move_iterator(last2), output, Compare());
+      return;
+    }
+
+    // Elements of the first sequence go before the equivalent elements of the second one
+    IT split1, split2;
+    if (size1 >= size2)
+    {
+      split1 = first1 + size1 / 2;
+      split2 = std::lower_bound(first2, last2, *split1, Compare());
+    }
+    else
+    {
+      split2 = first2 + size2 / 2;
+      split1 = std::upper_bound(first1, last1, *split2, Compare());
+    }
+
+    const auto splitOutput = output + (std::distance(first1, split1) + std::distance(first2, split2));
+    group.Run([&group, first1, split1, first2, split2, output, grainSize]()
+      { ParallelStableMergeLoop<IT, OutputIT, Compare>(group, first1, split1, first2, split2, output, grainSize); });
+    ParallelStableMergeLoop<IT, OutputIT, Compare>(group, split1, last1, split2, last2, splitOutput, grainSize);
+  }
+
+  /// Parallel Stable Sort Recursion - Fork the sort of the first half on the pool, sort the second half, then
+  /// merge both in parallel into the buffer and move them back.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param pool thread pool running the forked tasks.
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param buffer iterator to the part of the buffer matching [begin, end[.
+  /// @param grainSize size under which the sequence is sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT, typename Compare>
+  void ParallelStableSortRecursion(ThreadPool& pool, const IT& begin, const IT& end,
+    const typename std::vector<typename std::iterator_traits<IT>::value_type>::iterator& buffer,
+    const int grainSize)
+  {
+    typedef typename std::vector<typename std::iterator_traits<IT>::value_type>::iterator BufferIT;
+
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize <= grainSize)
+    {
+      // The buffer slice is free until the merge: use it as scratch
+      StableSort<IT, Compare>(begin, end, buffer);
+      return;
+    }
+
+    auto pivot = begin + ksize / 2;
+    const auto bufferPivot = buffer + ksize / 2;
+
+    // Sort both halves concurrently
+    {
+      TaskGroup group(pool);
+      group.Run([&pool, begin, pivot, buffer, grainSize]()
+        { ParallelStableSortRecursion<IT, Compare>(pool, begin, pivot, buffer, grainSize); });
+      ParallelStableSortRecursion<IT, Compare>(pool, pivot, end, bufferPivot, grainSize);
+      group.Wait();
+    }
+
+    // Sequences already in order
+    if (!Compare()(*pivot, *(pivot - 1)))
+      return;
+
+    // Merge both halves into the buffer then move them back, by chunks of the grain size
+    TaskGroup group(pool);
+    ParallelStableMergeLoop<IT, BufferIT, Compare>(group, begin, pivot, pivot, end, buffer, grainSize);
+    group.Wait();
+    for (int first = 0; first < ksize; first += grainSize)
+    {
+      const auto last = std::min(first + grainSize, ksize);
+      group.Run([begin, buffer, first, last]()
+        { std::move(buffer + first, buffer + last, begin + first); });
+    }
+    group.Wait();
+  }
+
+  /// Parallel Stable Sort - Proceed a stable sort on the elements using a work-stealing thread pool:
+  /// equivalent elements keep their relative order, whatever the pool and the grain size.
+  /// Halves are sorted concurrently by StableSort and merged in parallel through a buffer of N elements,
+  /// which is also the scratch of the sequential sorts: no allocation happens past the buffer one.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pool thread pool running the forked tasks.
+  /// @param grainSize size under which sequences are sorted and merged sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void ParallelStableSort(const IT& begin, const IT& end, ThreadPool& pool,
+                          const int grainSize = kParallelSortGrainSize)
+  {
+    const auto ksize = static_cast<const int>(std::distance(begin, end));
+    if (ksize < 2)
+      return;
+
+    std::vector<typename std::iterator_traits<IT>::value_type> buffer(ksize);
+    ParallelStableSortRecursion<IT, Compare>(pool, begin, end, buffer.begin(), std::max(grainSize, 1));
+  }
+
+  /// Parallel Stable Sort - Proceed a stable sort on the elements using a dedicated thread pool.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param threadCount number of threads running the sort, including the calling one (at least two).
+  /// @param grainSize size under which sequences are sorted and merged sequentially.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void ParallelStableSort(const IT& begin, const IT& end,
+                          const unsigned int threadCount = std::thread::hardware_concurrency(),
+                          const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    ThreadPool pool(ParallelSortWorkerCount(threadCount));
+    ParallelStableSort<IT, Compare>(begin, end, pool, grainSize);
+  }
+
+  /// Parallel American Flag Sort Loop - Same distribution as AmericanFlagSortLoop, forking the buckets
+  /// bigger than the grain size on the pool while the current thread carries on with the biggest one.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Digits digits traits of the elements (see AmericanFlagDigits).
+  ///
+  /// @param group task group collecting the forked buckets.
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depth number of leading digits shared by all the elements.
+  /// @param grainSize size under which the sequence is sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT, typename Digits>
+  void ParallelAmericanFlagSortLoop(TaskGroup& group, IT begin, IT end, std::size_t depth, const int grainSize)
+  {
+    const std::size_t kRadix = Digits::kRadix;
+    const auto kGrainSize = static_cast<std::size_t>(grainSize);
+    std::size_t bounds[Digits::kRadix + 1];
+
+    while (std::distance(begin, end) > grainSize)
+    {
+      AmericanFlagPartition<IT, Digits>(begin, end, depth, bounds);
+
+      // Find the biggest bucket still to be sorted
+      auto biggest = kRadix;
+      for (std::size_t digit = 0; digit < kRadix; ++digit)
+      {
+        const auto size = bounds[digit + 1] - bounds[digit];
+        if (size > 1 && !Digits::IsComplete(digit, depth) &&
+            (biggest == kRadix || size > bounds[biggest + 1] - bounds[biggest]))
+          biggest = digit;
+      }
+      if (biggest == kRadix)
+        return;
+
+      // Fork the big buckets, sort the small ones right away
+      for (std::size_t digit = 0; digit < kRadix; ++digit)
+      {
+        const auto size = bounds[digit + 1] - bounds[digit];
+        if (digit == biggest || size < 2 || Digits::IsComplete(digit, depth))
+          continue;
+
+        const auto forkBegin = begin + bounds[digit];
+        const auto forkEnd = begin + bounds[digit + 1];
+        if (size > kGrainSize)
+          group.Run([&group, forkBegin, forkEnd, depth, grainSize]()
+            { ParallelAmericanFlagSortLoop<IT, Digits>(group, forkBegin, forkEnd, depth + 1, grainSize); });
+        else
+          AmericanFlagSortLoop<IT, Digits>(forkBegin, forkEnd, depth + 1, kAmericanFlagInsertionCutoff);
+      }
+
+      end = begin + bounds[biggest + 1];
+      begin = begin + bounds[biggest];
+      ++depth;
+    }
+
+    AmericanFlagSortLoop<IT, Digits>(begin, end, depth, kAmericanFlagInsertionCutoff);
+  }
+
+  /// Parallel American Flag Sort - Proceed an in-place MSD raddix sort on the elements using a
+  /// work-stealing thread pool: buckets are distributed exactly as within AmericanFlagSort.
+  ///
+  /// @warning Not stable.
+  ///
+  /// @tparam IT type using to go through the collection.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pool thread pool running the forked buckets.
+  /// @param grainSize size under which buckets are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT>
+  void ParallelAmericanFlagSort(const IT& begin, const IT& end, ThreadPool& pool,
+                                const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    typedef AmericanFlagDigits<typename std::iterator_traits<IT>::value_type> Digits;
+    TaskGroup group(pool);
+    ParallelAmericanFlagSortLoop<IT, Digits>(group, begin, end, 0,
+                                             std::max(grainSize, kAmericanFlagInsertionCutoff));
+    group.Wait();
+  }
+
+  /// Parallel American Flag Sort - Proceed an in-place MSD raddix sort on the elements using a
+  /// dedicated thread pool.
+  ///
+  /// @warning Not stable.
+  ///
+  /// @tparam IT type using to go through the collection.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param threadCount number of threads running the sort, including the calling one (at least two).
+  /// @param grainSize size under which buckets are sorted sequentially.
+  ///
+  /// @return void.
+  template <typename IT>
+  void ParallelAmericanFlagSort(const IT& begin, const IT& end,
+                                const unsigned int threadCount = std::thread::hardware_concurrency(),
+                                const int grainSize = kParallelSortGrainSize)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    ThreadPool pool(ParallelSortWorkerCount(threadCount));
+    ParallelAmericanFlagSort<IT>(begin, end, pool, grainSize);
+  }
+
+  /// Default size of the slices processed by each thread within ParallelOddEvenBubble.
+  const int kParallelOddEvenGrainSize = 1 << 12;
+
+  /// Parallel Odd Even Bubble - Odd-even transposition sort (see OddEvenBubble) whose passes are split across
+  /// threads: each thread compare-exchanges the pairs of its own slice, all the threads meeting on a barrier
+  /// between passes to decide whether any of them swapped elements.
+  ///
+  /// @warning Compare should not throw: threads would be left waiting at the barrier.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param threadCount maximal number of threads running the passes (including the calling one).
+  /// @param grainSize minimal number of elements per thread.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void ParallelOddEvenBubble(const IT& begin, const IT& end,
+                             const unsigned int threadCount = std::thread::hardware_concurrency(),
+                             const int grainSize = kParallelOddEvenGrainSize)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    const auto sliceCount = static_cast<int>(
+      std::min<long long>(threadCount, distance / std::max(grainSize, 2)));
+    if (sliceCount < 2)
+    {
+      OddEvenBubble<IT, Compare>(begin, end);
+      return;
+    }
+
+    // Swap flags of the passes, rotating over three passes: the flag of the next pass is reset while the one of
+    // the previous pass may still be read, and the one of the current pass is written
+    std::atomic<bool> hasSwapped[3];
+    for (auto& flag : hasSwapped)
+      flag.store(false);
+
+    Barrier barrier(sliceCount);
+    auto sortSlice = [&](const int slice)
+    {
+      // Slices start at even indices: pairs of both parities never straddle two slices
+      const auto first = static_cast<int>(static_cast<long long>(distance) * slice / sliceCount) & ~1;
+      const auto last = (slice == sliceCount - 1) ? distance - 1 :
+        static_cast<int>(static_cast<long long>(distance) * (slice + 1) / sliceCount) & ~1;
+
+      const OddEvenPass<IT, Compare> pass(begin);
+      for (auto i = 0; i < distance; ++i)
+      {
+        if (slice == 0)
+          hasSwapped[(i + 1) % 3].store(false, std::memory_order_relaxed);
+        if (pass(first + (i & 1), last))
+          hasSwapped[i % 3].store(true, std::memory_order_relaxed);
+
+        barrier.Wait();
+        if (!hasSwapped[i % 3].load(std::memory_order_relaxed) && i > 0)
+          break;
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto slice = 1; slice < sliceCount; ++slice)
+      threads.push_back(std::thread(sortSlice, slice));
+    sortSlice(0);
+
+    for (auto& thread : threads)
+      thread.join();
+  }
+}
+
+#endif // MODULE_SORT_PARALLEL_HXX
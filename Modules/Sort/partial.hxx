@@ -0,0 +1,259 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PARTIAL_HXX
+#define MODULE_SORT_PARTIAL_HXX
+
+#include <heap.hxx>
+#include <insertion.hxx>
+#include <partition.hxx>
+#include <pivot.hxx>
+#include <quick.hxx>
+#include <sorting_network.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace SHA_Sort
+{
+  /// Size under which NthElement finishes the selection by sorting the remaining elements.
+  const int kNthElementInsertionCutoff = 16;
+
+  /// Size of the groups whose medians are gathered by MedianOfMedians.
+  const int kMedianOfMediansGroupSize = 5;
+
+  template <typename IT, typename Compare>
+  void NthElementLoop(IT begin, IT nth, IT end, int depthLimit);
+
+  /// Median Of Medians (BFPRT) - Gather the medians of groups of 5 elements at the beginning of the sequence
+  /// and select their median: at least 30% of the elements are lower and 30% greater than the pivot found,
+  /// which guarantees a linear selection whatever the input.
+  ///
+  /// @warning this method changes the elements order between your iterators.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sampled. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return iterator on the median of medians, end if the sequence is empty.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  IT MedianOfMedians(const IT& begin, const IT& end)
+  {
+    const auto size = static_cast<const int>(std::distance(begin, end));
+    if (size < 1)
+      return end;
+
+    // Move the median of each group to the beginning of the sequence
+    auto medians = begin;
+    for (auto group = begin; group < end;)
+    {
+      const auto last = group + std::min(kMedianOfMediansGroupSize, static_cast<int>(std::distance(group, end)));
+      InsertionSort<IT, Compare>(group, last);
+      std::iter_swap(medians++, group + std::distance(group, last - 1) / 2);
+      group = last;
+    }
+
+    // Select the median of the medians (linear as well, on a fifth of the elements)
+    const auto median = begin + std::distance(begin, medians - 1) / 2;
+    auto depthLimit = 0;
+    for (auto count = std::distance(begin, medians); count > 1; count >>= 1)
+      depthLimit += 2;
+    NthElementLoop<IT, Compare>(begin, median, medians, depthLimit);
+    return median;
+  }
+
+  /// NthElement Loop - Core of the introselect.
+  /// Partition the sequence around median of three / ninther pivots, only keeping the partition containing
+  /// the nth position, until it gets smaller than the insertion cutoff. Once the depth limit is reached,
+  /// pivots are found by median of medians and elements equivalent to the pivot are gathered (three-way
+  /// partition): the selection remains linear on adversarial inputs and sequences of duplicates.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of the sequence.
+  /// @param nth iterator to the position to be selected.
+  /// @param depthLimit number of partitioning levels allowed before switching to median of medians.
+  ///
+  /// @return void.
+  template <typename IT, typename Compare>
+  void NthElementLoop(IT begin, IT nth, IT end, int depthLimit)
+  {
+    while (std::distance(begin, end) > kNthElementInsertionCutoff)
+    {
+      // Too many unbalanced partitions: guarantee a linear selection on the remaining elements
+      if (depthLimit-- <= 0)
+      {
+        const auto pivot = MedianOfMedians<IT, Compare>(begin, end);
+        const auto equalRange = Partition3<IT, Compare>(begin, pivot, end);
+        if (nth < equalRange.first)
+          end = equalRange.first;
+        else if (nth >= equalRange.second)
+          begin = equalRange.second;
+        else
+          return;
+        continue;
+      }
+
+      auto pivot = SelectPivot<IT, Compare>(begin, end);          // Median of three / Ninther
+      auto newPivot = Partition<IT, Compare>(begin, pivot, end);  // Proceed partition
+
+      // Keep the partition containing the nth position
+      if (newPivot == nth)
+        return;
+      if (nth < newPivot)
+        end = newPivot;
+      else
+        begin = newPivot + 1;
+    }
+
+    SmallSort<IT, Compare>(begin, end);
+  }
+
+  /// NthElement - Rearrange the elements so that the element at the nth position is the one that would be
+  /// there if the sequence was sorted, no element of [begin, nth[ being greater and no element of ]nth, end[
+  /// being lower than it (introselect).
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N) on average, O(N log N) in the worst case.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be processed. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param nth iterator to the position to be selected, nothing is done if not within [begin, end[.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void NthElement(const IT& begin, const IT& nth, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2 || nth < begin || nth >= end)
+      return;
+
+    // Depth limit set to 2 * floor(log2(N))
+    auto depthLimit = 0;
+    for (auto size = distance; size > 1; size >>= 1)
+      depthLimit += 2;
+
+    NthElementLoop<IT, Compare>(begin, nth, end, depthLimit);
+  }
+
+  /// Partial Heap Sort (Heap Select) - Rearrange the elements so that [begin, middle[ contains the sorted
+  /// smallest elements of the sequence: a max-heap of the k first elements is built, each remaining element
+  /// lower than its root replaces it, then the heap is sorted.
+  ///
+  /// @remark most elements are rejected by a single comparison with the root when k is much smaller than N:
+  /// faster than NthElement for small top-k, O(N log k) on adversarial (e.g. reversed) sequences.
+  ///
+  /// @complexity O(N log k + k log k) in the worst case.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be processed. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param middle iterator to the end of the sequence to be sorted, nothing is done if not within [begin, end].
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void PartialHeapSort(const IT& begin, const IT& middle, const IT& end)
+  {
+    const auto k = static_cast<const int>(std::distance(begin, middle));
+    if (k < 1 || middle > end)
+      return;
+
+    // Build the heap of the k first elements
+    for (auto root = k / 2 - 1; root >= 0; --root)
+      SiftDown<IT, Compare>(begin, root, k);
+
+    // Replace the root by any lower element
+    for (auto it = middle; it < end; ++it)
+    {
+      if (Compare()(*it, *begin))
+      {
+        std::iter_swap(it, begin);
+        SiftDown<IT, Compare>(begin, 0, k);
+      }
+    }
+
+    // Repeatedly extract the root to the end of the heap
+    for (auto last = k - 1; last > 0; --last)
+    {
+      std::iter_swap(begin, begin + last);
+      SiftDown<IT, Compare>(begin, 0, last);
+    }
+  }
+
+  /// Ratio between the sequence size and the number of sorted elements above which PartialSort selects
+  /// the elements through a heap rather than through NthElement.
+  const int kPartialSortHeapRatio = 256;
+
+  /// Partial Sort - Rearrange the elements so that [begin, middle[ contains the sorted smallest elements
+  /// of the sequence (top-k), the order of the remaining elements within [middle, end[ being unspecified.
+  /// Small top-k are selected through a heap (PartialHeapSort). Otherwise the nth element is first
+  /// selected (NthElement), then only [begin, middle[ is sorted (QuickSort).
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N + k log k) on average with k the number of sorted elements.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be processed. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param middle iterator to the end of the sequence to be sorted, nothing is done if not within [begin, end].
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void PartialSort(const IT& begin, const IT& middle, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2 || middle <= begin || middle > end)
+      return;
+
+    if (static_cast<long long>(std::distance(begin, middle)) * kPartialSortHeapRatio < distance)
+    {
+      PartialHeapSort<IT, Compare>(begin, middle, end);
+      return;
+    }
+
+    // Gather the smallest elements before the middle then sort them
+    NthElement<IT, Compare>(begin, middle - 1, end);
+    QuickSort<IT, Compare>(begin, middle - 1);
+  }
+}
+
+#endif // MODULE_SORT_PARTIAL_HXX
@@ -20,12 +20,28 @@
 #ifndef MODULE_SORT_PARTITION_HXX
 #define MODULE_SORT_PARTITION_HXX
 
+#include <traits.hxx>
+
 // STD includes
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace SHA_Sort
 {
-  /// Partition-Exchange - Proceed an in-place patitionning on the elements.
+  /// Size of the blocks used by BlockPartition: offsets fit within an unsigned char.
+  const int kBlockPartitionSize = 128;
+
+  /// Lomuto Partition-Exchange - Proceed an in-place patitionning on the elements,
+  /// swapping each element belonging to the left partition with a single store pointer.
   ///
   /// @tparam IT type using to go through the collection.
   /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
@@ -39,7 +55,7 @@ namespace SHA_Sort
   /// @return new pivot iterator.
   template <typename IT,
             typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
-  IT Partition(const IT& begin, const IT& pivot, const IT& end)
+  IT LomutoPartition(const IT& begin, const IT& pivot, const IT& end)
   {
     if (std::distance(begin, end) < 2 || pivot == end)
       return pivot;
@@ -63,6 +79,454 @@ namespace SHA_Sort
 
     return store;
   }
+
+  /// Block Partition-Exchange (BlockQuicksort) - Proceed an in-place patitionning on the elements
+  /// without any branch depending on the comparisons.
+  /// Comparison results of a block of elements on each side are first buffered as offsets of the misplaced
+  /// elements, misplaced pairs are then swapped in a second loop.
+  ///
+  /// @remark much faster than the Lomuto partition on cheap comparisons (e.g. arithmetic values)
+  /// as it avoids branch mispredictions.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
+  /// std::greater_equal for greater elements in left partition).
+  ///
+  /// @param begin,end const iterators to the initial and final positions of
+  /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pivot iterator on which the partition is delimited between begin and end.
+  ///
+  /// @return new pivot iterator.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT BlockPartition(const IT& begin, const IT& pivot, const IT& end)
+  {
+    if (std::distance(begin, end) < 2 || pivot == end)
+      return pivot;
+
+    const auto pivotValue = *pivot; // Keep the pivot value;
+    std::swap(*pivot, *(end - 1));  // Put the pivot at the end for convenience
+
+    // [begin, first[ belongs to the left partition, [last, end - 1[ to the right one
+    auto first = begin;
+    auto last = end - 1;
+    unsigned char offsetsLeft[kBlockPartitionSize];
+    unsigned char offsetsRight[kBlockPartitionSize];
+    int startLeft = 0, numLeft = 0, startRight = 0, numRight = 0;
+    while (std::distance(first, last) > 2 * kBlockPartitionSize)
+    {
+      // Buffer offsets of the left block elements belonging to the right partition
+      if (numLeft == 0)
+      {
+        startLeft = 0;
+        for (int i = 0; i < kBlockPartitionSize; ++i)
+        {
+          offsetsLeft[numLeft] = static_cast<unsigned char>(i);
+          numLeft += !Compare()(*(first + i), pivotValue);
+        }
+      }
+
+      // Buffer offsets of the right block elements belonging to the left partition
+      if (numRight == 0)
+      {
+        startRight = 0;
+        for (int i = 0; i < kBlockPartitionSize; ++i)
+        {
+          offsetsRight[numRight] = static_cast<unsigned char>(i);
+          numRight += Compare()(*(last - 1 - i), pivotValue);
+        }
+      }
+
+      // Swap the misplaced pairs
+      const auto num = std::min(numLeft, numRight);
+      for (int i = 0; i < num; ++i)
+        std::swap(*(first + offsetsLeft[startLeft + i]), *(last - 1 - offsetsRight[startRight + i]));
+
+      numLeft -= num;
+      numRight -= num;
+      startLeft += num;
+      startRight += num;
+
+      // Move on to the next block once all misplaced elements have been swapped
+      if (numLeft == 0)
+        first += kBlockPartitionSize;
+      if (numRight == 0)
+        last -= kBlockPartitionSize;
+    }
+
+    // Finish the remaining elements (including unfinished blocks) with a branchless Lomuto loop:
+    // the swap is turned into conditional moves so that the result matches the LomutoPartition one
+    auto store = first;
+    for (auto it = first; it != last; ++it)
+    {
+      const auto storeValue = *store;
+      const auto value = *it;
+      const bool isLeft = Compare()(value, pivotValue);
+      *it = isLeft ? storeValue : value;
+      *store = isLeft ? value : storeValue;
+      store += isLeft;
+    }
+
+    // Replace the pivot at its good position
+    std::swap(*(end - 1), *store);
+
+    return store;
+  }
+
+#if defined(__AVX2__)
+  /// Minimum size of the sequences processed by VectorizedPartition, BlockPartition being used below.
+  const int kVectorizedPartitionMinSize = 64;
+
+  /// Vectorized Partition Lanes - AVX2 comparisons of 32 / 64 bits arithmetic values.
+  template <typename T>
+  struct VectorizedPartitionLanes;
+
+  template <>
+  struct VectorizedPartitionLanes<std::int32_t>
+  {
+    static const int kLanes = 8;
+    static __m256i Set(const std::int32_t value) { return _mm256_set1_epi32(value); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b))); }
+  };
+
+  template <>
+  struct VectorizedPartitionLanes<std::uint32_t>
+  {
+    static const int kLanes = 8;
+    static __m256i Set(const std::uint32_t value) { return _mm256_set1_epi32(static_cast<std::int32_t>(value)); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    {
+      // Flip the sign bits to compare unsigned values as signed ones
+      const auto sign = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+      return _mm256_movemask_ps(_mm256_castsi256_ps(
+        _mm256_cmpgt_epi32(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign))));
+    }
+  };
+
+  template <>
+  struct VectorizedPartitionLanes<float>
+  {
+    static const int kLanes = 8;
+    static __m256i Set(const float value) { return _mm256_castps_si256(_mm256_set1_ps(value)); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    { return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_GT_OQ)); }
+  };
+
+  template <>
+  struct VectorizedPartitionLanes<std::int64_t>
+  {
+    static const int kLanes = 4;
+    static __m256i Set(const std::int64_t value) { return _mm256_set1_epi64x(value); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b))); }
+  };
+
+  template <>
+  struct VectorizedPartitionLanes<std::uint64_t>
+  {
+    static const int kLanes = 4;
+    static __m256i Set(const std::uint64_t value) { return _mm256_set1_epi64x(static_cast<std::int64_t>(value)); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    {
+      // Flip the sign bits to compare unsigned values as signed ones
+      const auto sign = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+      return _mm256_movemask_pd(_mm256_castsi256_pd(
+        _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign))));
+    }
+  };
+
+  template <>
+  struct VectorizedPartitionLanes<double>
+  {
+    static const int kLanes = 4;
+    static __m256i Set(const double value) { return _mm256_castpd_si256(_mm256_set1_pd(value)); }
+    static int GreaterMask(const __m256i a, const __m256i b)
+    { return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_GT_OQ)); }
+  };
+
+  /// Vectorized Partition Compare - Mask of the lanes belonging to the left partition for the standard functors.
+  template <typename Compare, typename T>
+  struct VectorizedPartitionCompare;
+
+  template <typename T>
+  struct VectorizedPartitionCompare<std::less_equal<T>, T>
+  {
+    static int LeftMask(const __m256i values, const __m256i pivot)
+    { return ~VectorizedPartitionLanes<T>::GreaterMask(values, pivot) & ((1 << VectorizedPartitionLanes<T>::kLanes) - 1); }
+  };
+
+  template <typename T>
+  struct VectorizedPartitionCompare<std::less<T>, T>
+  {
+    static int LeftMask(const __m256i values, const __m256i pivot)
+    { return VectorizedPartitionLanes<T>::GreaterMask(pivot, values); }
+  };
+
+  template <typename T>
+  struct VectorizedPartitionCompare<std::greater_equal<T>, T>
+  {
+    static int LeftMask(const __m256i values, const __m256i pivot)
+    { return ~VectorizedPartitionLanes<T>::GreaterMask(pivot, values) & ((1 << VectorizedPartitionLanes<T>::kLanes) - 1); }
+  };
+
+  template <typename T>
+  struct VectorizedPartitionCompare<std::greater<T>, T>
+  {
+    static int LeftMask(const __m256i values, const __m256i pivot)
+    { return VectorizedPartitionLanes<T>::GreaterMask(values, pivot); }
+  };
+
+  /// Vectorized Partition Table - For each lane mask, permutation of the 32 bits slots moving the left lanes
+  /// first and the right lanes last (one slot index per nibble), and number of left lanes.
+  struct VectorizedPartitionTable
+  {
+    explicit VectorizedPartitionTable(const int lanes)
+    {
+      const int slotsPerLane = 8 / lanes;
+      for (int mask = 0; mask < (1 << lanes); ++mask)
+      {
+        int order[8];
+        int count = 0;
+        for (int lane = 0; lane < lanes; ++lane)
+          if (mask & (1 << lane))
+            order[count++] = lane;
+        for (int lane = 0, right = count; lane < lanes; ++lane)
+          if (!(mask & (1 << lane)))
+            order[right++] = lane;
+
+        permutations[mask] = 0;
+        for (int slot = 0; slot < 8; ++slot)
+        {
+          const auto source = order[slot / slotsPerLane] * slotsPerLane + slot % slotsPerLane;
+          permutations[mask] |= static_cast<std::uint32_t>(source) << (4 * slot);
+        }
+        counts[mask] = static_cast<unsigned char>(count);
+      }
+    }
+
+    std::uint32_t permutations[256];
+    unsigned char counts[256];
+  };
+
+  /// Vectorized Partition Permutations - Table shared by all the partitions on Lanes lanes.
+  template <int Lanes>
+  const VectorizedPartitionTable& VectorizedPartitionPermutations()
+  {
+    static const VectorizedPartitionTable table(Lanes);
+    return table;
+  }
+
+  /// Vectorized Partition-Exchange - Proceed an in-place partitionning of contiguous 32 / 64 bits
+  /// arithmetic values using AVX2, comparing a whole register of elements against the pivot at once.
+  /// A register is first saved on each side to free some space, then each register read is split
+  /// through a permutation moving its left elements first and its right elements last, and stored on
+  /// both sides (compress store). Registers are read from the side with the least free space so that
+  /// the stores never overwrite unread elements.
+  ///
+  /// @warning NaN values are not supported.
+  ///
+  /// @tparam IT type using to go through the collection (contiguous).
+  /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
+  /// std::greater_equal for greater elements in left partition, std::less or std::greater).
+  ///
+  /// @param begin,end const iterators to the initial and final positions of
+  /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pivot iterator on which the partition is delimited between begin and end.
+  ///
+  /// @return new pivot iterator.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT VectorizedPartition(const IT& begin, const IT& pivot, const IT& end)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    typedef VectorizedPartitionLanes<Value> Lanes;
+    const int kLanes = Lanes::kLanes;
+
+    const auto size = std::distance(begin, end);
+    if (size < kVectorizedPartitionMinSize || pivot == end)
+      return BlockPartition<IT, Compare>(begin, pivot, end);
+
+    const Value pivotValue = *pivot; // Keep the pivot value;
+    std::swap(*pivot, *(end - 1));   // Put the pivot at the end for convenience
+
+    // [data, writeLeft[ belongs to the left partition, [writeRight, data + size - 1[ to the right one,
+    // [readLeft, readRight[ is still to be read
+    Value* const data = &*begin;
+    auto writeLeft = data;
+    auto writeRight = data + size - 1;
+    auto readLeft = writeLeft + kLanes;
+    auto readRight = writeRight - kLanes;
+    const auto savedLeft = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(writeLeft));
+    const auto savedRight = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(readRight));
+
+    const auto pivotRegister = Lanes::Set(pivotValue);
+    const auto& table = VectorizedPartitionPermutations<kLanes>();
+    const auto nibbleShifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    while (readRight - readLeft >= kLanes)
+    {
+      __m256i values;
+      if (readLeft - writeLeft <= writeRight - readRight)
+      {
+        values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(readLeft));
+        readLeft += kLanes;
+      }
+      else
+      {
+        readRight -= kLanes;
+        values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(readRight));
+      }
+
+      // Move the left elements first, the right ones last, and store the register on both sides
+      const auto mask = VectorizedPartitionCompare<Compare, Value>::LeftMask(values, pivotRegister);
+      const auto slots = _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(table.permutations[mask])), nibbleShifts),
+        _mm256_set1_epi32(7));
+      const auto permuted = _mm256_permutevar8x32_epi32(values, slots);
+      const int count = table.counts[mask];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(writeLeft), permuted);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(writeRight - kLanes), permuted);
+      writeLeft += count;
+      writeRight -= kLanes - count;
+    }
+
+    // The free space [writeLeft, writeRight[ exactly fits the unread elements and the saved registers
+    Value remaining[3 * kLanes];
+    const auto unread = std::copy(readLeft, readRight, remaining);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(unread), savedLeft);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(unread + kLanes), savedRight);
+    for (auto it = remaining; it != unread + 2 * kLanes; ++it)
+    {
+      const auto value = *it;
+      const bool isLeft = Compare()(value, pivotValue);
+      *writeLeft = value;
+      *(writeRight - 1) = value;
+      writeLeft += isLeft;
+      writeRight -= !isLeft;
+    }
+
+    // Replace the pivot at its good position
+    std::swap(*(end - 1), *writeLeft);
+
+    return begin + (writeLeft - data);
+  }
+
+  /// IsVectorizedPartition - Determine whether VectorizedPartition handles the sequence: contiguous
+  /// 32 / 64 bits integers or floating points ordered by a standard functor.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type.
+  template <typename IT, typename Compare,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsVectorizedPartition : std::integral_constant<bool,
+    IsContiguousIterator<IT>::value &&
+    (std::is_same<Value, std::int32_t>::value || std::is_same<Value, std::uint32_t>::value ||
+     std::is_same<Value, std::int64_t>::value || std::is_same<Value, std::uint64_t>::value ||
+     std::is_same<Value, float>::value || std::is_same<Value, double>::value) &&
+    (std::is_same<Compare, std::less_equal<Value>>::value || std::is_same<Compare, std::less<Value>>::value ||
+     std::is_same<Compare, std::greater_equal<Value>>::value || std::is_same<Compare, std::greater<Value>>::value)>
+  {};
+
+  /// Contiguous Partition-Exchange - VectorizedPartition dispatch.
+  template <typename IT, typename Compare>
+  IT ContiguousPartition(const IT& begin, const IT& pivot, const IT& end, std::true_type)
+  {
+    return VectorizedPartition<IT, Compare>(begin, pivot, end);
+  }
+#else
+  /// IsVectorizedPartition - No vectorized partition without AVX2.
+  template <typename IT, typename Compare>
+  struct IsVectorizedPartition : std::false_type {};
+#endif
+
+  /// Contiguous Partition-Exchange - BlockPartition dispatch.
+  template <typename IT, typename Compare>
+  IT ContiguousPartition(const IT& begin, const IT& pivot, const IT& end, std::false_type)
+  {
+    return BlockPartition<IT, Compare>(begin, pivot, end);
+  }
+
+  /// Partition-Exchange - Dispatch for contiguous sequences of arithmetic values: VectorizedPartition
+  /// if available (AVX2, 32 / 64 bits values, standard functor), BlockPartition otherwise.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT Partition(const IT& begin, const IT& pivot, const IT& end, std::true_type)
+  {
+    return ContiguousPartition<IT, Compare>(begin, pivot, end, typename IsVectorizedPartition<IT, Compare>::type());
+  }
+
+  /// Partition-Exchange - LomutoPartition dispatch for any other sequence.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT Partition(const IT& begin, const IT& pivot, const IT& end, std::false_type)
+  {
+    return LomutoPartition<IT, Compare>(begin, pivot, end);
+  }
+
+  /// Partition-Exchange - Proceed an in-place patitionning on the elements.
+  /// Dispatch to the AVX2 VectorizedPartition or to the branchless BlockPartition on contiguous sequences
+  /// of arithmetic values, to the LomutoPartition otherwise.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
+  /// std::greater_equal for greater elements in left partition).
+  ///
+  /// @param begin,end const iterators to the initial and final positions of
+  /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pivot iterator on which the partition is delimited between begin and end.
+  ///
+  /// @return new pivot iterator.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT Partition(const IT& begin, const IT& pivot, const IT& end)
+  {
+    return Partition<IT, Compare>(begin, pivot, end, typename IsContiguousArithmetic<IT>::type());
+  }
+
+  /// Three-Way Partition (Dutch National Flag) - Proceed an in-place partitionning on the elements,
+  /// gathering all the elements equivalent to the pivot within a middle block.
+  /// Result in: [begin, lt[ < pivot == [lt, gt[ < [gt, end[ (with respect to Compare).
+  ///
+  /// @remark the equal block does not need any further processing: sequences with few distinct values
+  /// get partitioned in few passes.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less for smaller elements in left partition,
+  /// std::greater for greater elements in left partition).
+  ///
+  /// @param begin,end const iterators to the initial and final positions of
+  /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param pivot iterator on which the partition is delimited between begin and end.
+  ///
+  /// @return [lt, gt[ range of the elements equivalent to the pivot, [pivot, pivot[ if nothing to process.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  std::pair<IT, IT> Partition3(const IT& begin, const IT& pivot, const IT& end)
+  {
+    if (std::distance(begin, end) < 1 || pivot == end)
+      return std::make_pair(pivot, pivot);
+
+    const auto pivotValue = *pivot; // Keep the pivot value
+    auto lt = begin;                // End of the smaller elements
+    auto gt = end;                  // Beginning of the greater elements
+
+    // Dispatch each element within its block, elements within [lt, it[ being equivalent to the pivot
+    for (auto it = begin; it < gt;)
+    {
+      if (Compare()(*it, pivotValue))
+        std::swap(*lt++, *it++);
+      else if (Compare()(pivotValue, *it))
+        std::swap(*it, *--gt);
+      else
+        ++it;
+    }
+
+    return std::make_pair(lt, gt);
+  }
 }
 
 #endif // MODULE_SORT_PARTITION_HXX
@@ -0,0 +1,196 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PIVOT_HXX
+#define MODULE_SORT_PIVOT_HXX
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+
+namespace SHA_Sort
+{
+  /// Median Of Three - Find the median element out of three.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  ///
+  /// @param a,b,c iterators on the three candidates.
+  ///
+  /// @return iterator on the median element.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT MedianOfThree(const IT& a, const IT& b, const IT& c)
+  {
+    if (Compare()(*a, *b))
+      return Compare()(*b, *c) ? b : (Compare()(*a, *c) ? c : a);
+
+    return Compare()(*a, *c) ? a : (Compare()(*b, *c) ? c : b);
+  }
+
+  /// Ninther - Tukey's median of the three medians of three evenly spaced samples.
+  /// Gives a much better estimate of the median than the median of three on large sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sampled. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return iterator on the pseudo median element, end if the sequence is empty.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT Ninther(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 1)
+      return end;
+
+    const auto step = distance / 8;
+    const auto middle = begin + distance / 2;
+    const auto last = end - 1;
+
+    return MedianOfThree<IT, Compare>(
+      MedianOfThree<IT, Compare>(begin, begin + step, begin + 2 * step),
+      MedianOfThree<IT, Compare>(middle - step, middle, middle + step),
+      MedianOfThree<IT, Compare>(last - 2 * step, last - step, last));
+  }
+
+  /// Select Pivot - Pick a pivot from the sequence: median of three on small sequences,
+  /// ninther on large ones.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sampled. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return iterator on the selected pivot, end if the sequence is empty.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  IT SelectPivot(const IT& begin, const IT& end)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 1)
+      return end;
+    if (distance >= 128)
+      return Ninther<IT, Compare>(begin, end);
+
+    return MedianOfThree<IT, Compare>(begin, begin + distance / 2, end - 1);
+  }
+
+  /// Default seed of the pivot random generator of each thread.
+  const std::uint64_t kPivotRandomSeed = 0x9E3779B97F4A7C15ULL;
+
+  /// @class PivotRandom
+  ///
+  /// xorshift64* pseudo-random generator picking random pivots: one state per thread, so that concurrent
+  /// sorts never contend, each thread starting from the same seed so that runs are reproducible.
+  class PivotRandom
+  {
+    public:
+      /// Reset the generator of the calling thread.
+      ///
+      /// @param seed new state of the generator, the default seed if 0 (xorshift state should not be null).
+      ///
+      /// @return void.
+      static void Seed(const std::uint64_t seed = kPivotRandomSeed)
+      { State() = (seed != 0) ? seed : kPivotRandomSeed; }
+
+      /// @return next pseudo-random value of the calling thread.
+      static std::uint64_t Next()
+      {
+        auto& state = State();
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+      }
+
+      /// @param count number of possible values (lower than 2^32).
+      ///
+      /// @return pseudo-random value within [0, count[ (multiply-shift, no division).
+      static std::size_t Uniform(const std::size_t count)
+      { return static_cast<std::size_t>(((Next() >> 32) * static_cast<std::uint32_t>(count)) >> 32); }
+
+    private:
+      static std::uint64_t& State()
+      {
+        static thread_local std::uint64_t state = kPivotRandomSeed;
+        return state;
+      }
+  };
+
+  /// Pivot selection policies - Pluggable pivot selection of the partitioning algorithms (QuickSort,
+  /// KthOrderStatistic): Select<IT, Compare>(begin, end) returns an iterator on the pivot, end if the
+  /// sequence is empty.
+
+  /// Adaptive Pivot - Median of three on small sequences, ninther on large ones (see SelectPivot).
+  struct AdaptivePivot
+  {
+    template <typename IT, typename Compare>
+    static IT Select(const IT& begin, const IT& end) { return SelectPivot<IT, Compare>(begin, end); }
+  };
+
+  /// Median Of Three Pivot - Median of the first, middle and last elements.
+  struct MedianOfThreePivot
+  {
+    template <typename IT, typename Compare>
+    static IT Select(const IT& begin, const IT& end)
+    {
+      const auto distance = static_cast<const int>(std::distance(begin, end));
+      return (distance < 1) ? end : MedianOfThree<IT, Compare>(begin, begin + distance / 2, end - 1);
+    }
+  };
+
+  /// Ninther Pivot - Tukey's ninther whatever the sequence size.
+  struct NintherPivot
+  {
+    template <typename IT, typename Compare>
+    static IT Select(const IT& begin, const IT& end) { return Ninther<IT, Compare>(begin, end); }
+  };
+
+  /// Middle Pivot - Deterministic middle element, without any comparison.
+  struct MiddlePivot
+  {
+    template <typename IT, typename Compare>
+    static IT Select(const IT& begin, const IT& end)
+    {
+      const auto distance = static_cast<const int>(std::distance(begin, end));
+      return (distance < 1) ? end : begin + distance / 2;
+    }
+  };
+
+  /// Random Pivot - Uniformly picked element, using the generator of the calling thread (see PivotRandom).
+  struct RandomPivot
+  {
+    template <typename IT, typename Compare>
+    static IT Select(const IT& begin, const IT& end)
+    {
+      const auto distance = static_cast<const int>(std::distance(begin, end));
+      return (distance < 1) ? end : begin + static_cast<int>(PivotRandom::Uniform(distance));
+    }
+  };
+}
+
+#endif // MODULE_SORT_PIVOT_HXX
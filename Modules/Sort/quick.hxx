@@ -20,33 +20,185 @@
 #ifndef MODULE_SORT_QUICK_HXX
 #define MODULE_SORT_QUICK_HXX
 
+#include <heap.hxx>
+#include <insertion.hxx>
 #include <partition.hxx>
+#include <pivot.hxx>
+#include <sorting_network.hxx>
+
+// STD includes
+#include <functional>
+#include <iterator>
 
 namespace SHA_Sort
 {
+  /// Default size under which QuickSort finishes a partition using a sorting network or an insertion sort.
+  const int kQuickSortInsertionCutoff = 16;
+
+  /// IntroSort Loop - Core of the hybrid quick sort.
+  /// Partition the sequence until it gets smaller than the insertion cutoff, or fallback on a heap sort
+  /// once the depth limit is reached.
+  /// Only the smallest partition is recursed on, the biggest one being handled by the loop: the stack
+  /// usage is kept in O(log N).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Pivot pivot selection policy (see AdaptivePivot).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depthLimit number of partitioning levels allowed before switching to heap sort.
+  /// @param insertionCutoff size under which the sequence is sorted using an insertion sort.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void IntroSortLoop(IT begin, IT end, int depthLimit, const int insertionCutoff)
+  {
+    while (std::distance(begin, end) > insertionCutoff)
+    {
+      // Too many unbalanced partitions: guarantee O(N log N) on the remaining elements
+      if (depthLimit-- <= 0)
+      {
+        HeapSort<IT, Compare>(begin, end);
+        return;
+      }
+
+      auto pivot = Pivot::template Select<IT, Compare>(begin, end);  // Median of three / Ninther by default
+      auto newPivot = Partition<IT, Compare>(begin, pivot, end);     // Proceed partition
+
+      // Recurse on the smallest partition, loop on the biggest one
+      if (std::distance(begin, newPivot) < std::distance(newPivot + 1, end))
+      {
+        IntroSortLoop<IT, Compare, Pivot>(begin, newPivot, depthLimit, insertionCutoff);
+        begin = newPivot + 1;
+      }
+      else
+      {
+        IntroSortLoop<IT, Compare, Pivot>(newPivot + 1, end, depthLimit, insertionCutoff);
+        end = newPivot;
+      }
+    }
+
+    SmallSort<IT, Compare>(begin, end);
+  }
+
   /// Quick Sort - Proceed an in-place sort on the elements.
+  /// Hybrid implementation (IntroSort): median of three / ninther pivot, sorting network (arithmetic values)
+  /// or insertion sort on small partitions and heap sort fallback once the recursion depth exceeds 2 * log2(N).
+  ///
+  /// @complexity O(N log N) in the worst case, O(log N) stack.
   ///
   /// @tparam IT type using to go through the collection.
   /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+  /// @tparam Pivot pivot selection policy: AdaptivePivot (default), MedianOfThreePivot, NintherPivot,
+  /// MiddlePivot (deterministic) or RandomPivot (per-thread reproducible generator).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param insertionCutoff size under which partitions are sorted using an insertion sort.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void QuickSort(const IT& begin, const IT& end, const int insertionCutoff = kQuickSortInsertionCutoff)
+  {
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Depth limit set to 2 * floor(log2(N))
+    auto depthLimit = 0;
+    for (auto size = distance; size > 1; size >>= 1)
+      depthLimit += 2;
+
+    IntroSortLoop<IT, Compare, Pivot>(begin, end, depthLimit, insertionCutoff);
+  }
+
+  /// IntroSort Loop 3-Way - Core of the duplicate-aware hybrid quick sort.
+  /// Same as IntroSortLoop, using a three-way partition: the block of elements equivalent to the pivot is
+  /// excluded from any further processing.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam Pivot pivot selection policy (see AdaptivePivot).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depthLimit number of partitioning levels allowed before switching to heap sort.
+  /// @param insertionCutoff size under which the sequence is sorted using an insertion sort.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void IntroSort3WayLoop(IT begin, IT end, int depthLimit, const int insertionCutoff)
+  {
+    while (std::distance(begin, end) > insertionCutoff)
+    {
+      // Too many unbalanced partitions: guarantee O(N log N) on the remaining elements
+      if (depthLimit-- <= 0)
+      {
+        HeapSort<IT, Compare>(begin, end);
+        return;
+      }
+
+      auto pivot = Pivot::template Select<IT, Compare>(begin, end);  // Median of three / Ninther by default
+      auto equalRange = Partition3<IT, Compare>(begin, pivot, end);   // Proceed three-way partition
+
+      // Recurse on the smallest partition, loop on the biggest one - skip the equal block
+      if (std::distance(begin, equalRange.first) < std::distance(equalRange.second, end))
+      {
+        IntroSort3WayLoop<IT, Compare, Pivot>(begin, equalRange.first, depthLimit, insertionCutoff);
+        begin = equalRange.second;
+      }
+      else
+      {
+        IntroSort3WayLoop<IT, Compare, Pivot>(equalRange.second, end, depthLimit, insertionCutoff);
+        end = equalRange.first;
+      }
+    }
+
+    SmallSort<IT, Compare>(begin, end);
+  }
+
+  /// Quick Sort 3-Way - Proceed an in-place sort on the elements, optimized for sequences containing
+  /// many duplicates: each partition step puts aside all the elements equivalent to the pivot.
+  ///
+  /// @remark sequences of N elements with only K distinct values are sorted in O(N log K).
+  ///
+  /// @complexity O(N log N) in the worst case, O(log N) stack.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  /// @tparam Pivot pivot selection policy (see QuickSort).
   ///
   /// @param begin,end iterators to the initial and final positions of
   /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
   /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param insertionCutoff size under which partitions are sorted using an insertion sort.
   ///
   /// @return void.
   template <typename IT,
-            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
-  void QuickSort(const IT& begin, const IT& end)
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename Pivot = AdaptivePivot>
+  void QuickSort3Way(const IT& begin, const IT& end, const int insertionCutoff = kQuickSortInsertionCutoff)
   {
     const auto distance = static_cast<const int>(std::distance(begin, end));
     if (distance < 2)
       return;
 
-    auto pivot = begin + (rand() % distance);                   // Pick Random Pivot € [begin, end]
-    auto newPivot = Partition<IT, Compare>(begin, pivot, end);  // Proceed partition
+    // Depth limit set to 2 * floor(log2(N))
+    auto depthLimit = 0;
+    for (auto size = distance; size > 1; size >>= 1)
+      depthLimit += 2;
 
-    QuickSort<IT, Compare>(begin, newPivot);   // Recurse on first partition
-    QuickSort<IT, Compare>(newPivot + 1, end); // Recurse on second partition
+    IntroSort3WayLoop<IT, Compare, Pivot>(begin, end, depthLimit, insertionCutoff);
   }
 }
 
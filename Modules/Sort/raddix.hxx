@@ -21,53 +21,396 @@
 #define MODULE_SORT_RADDIX_HXX
 
 // STD includes
-#include <queue>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace SHA_Sort
 {
-  /// LSD Raddix Sort - Non-comparative integer sorting algorithm
-  /// Proceed a raddix-sort on the elements contained in [begin, end[
+  /// Raddix Key - Order-preserving transform of an arithmetic value into an unsigned key:
+  /// a < b if and only if Encode(a) < Encode(b) as unsigned integers.
   ///
-  /// @warning Works properly only with integral type of non-negative values.
+  /// @tparam T arithmetic type of the values.
+  template <typename T, typename Enable = void>
+  struct RaddixKey;
+
+  /// Raddix Key - Unsigned integers are their own keys.
+  template <typename T>
+  struct RaddixKey<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type>
+  {
+    typedef T Type;
+    static Type Encode(const T value) { return value; }
+  };
+
+  /// Raddix Key - Signed integers (two's complement) have their sign bit flipped so that negative
+  /// values come first.
+  template <typename T>
+  struct RaddixKey<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type>
+  {
+    typedef typename std::make_unsigned<T>::type Type;
+    static Type Encode(const T value)
+    { return static_cast<Type>(static_cast<Type>(value) ^ (Type(1) << (sizeof(Type) * 8 - 1))); }
+  };
+
+  /// Raddix Key - IEEE-754 floating points: positive values have their sign bit set, negative values
+  /// have all their bits flipped so that their order is reversed.
+  ///
+  /// @remark -0.0 comes before +0.0, NaN values come first or last depending on their sign bit.
+  template <typename T>
+  struct RaddixKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+  {
+    static_assert(std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8),
+                  "RaddixSort supports only 32 and 64 bits IEEE-754 floating points");
+    typedef typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type Type;
+    static Type Encode(const T value)
+    {
+      const Type kSignBit = Type(1) << (sizeof(Type) * 8 - 1);
+      Type bits;
+      std::memcpy(&bits, &value, sizeof(Type));
+      return (bits & kSignBit) ? static_cast<Type>(~bits) : static_cast<Type>(bits | kSignBit);
+    }
+  };
+
+  /// Raddix Identity - Default key extractor: the key of an element is the element itself.
+  struct RaddixIdentity
+  {
+    template <typename T>
+    const T& operator()(const T& value) const { return value; }
+  };
+
+  /// Raddix Scatter - Counting sort pass: move each element of the source sequence to the destination
+  /// at the offset of its digit bucket.
+  ///
+  /// @tparam SrcIT type using to go through the source collection.
+  /// @tparam DstIT type using to go through the destination collection.
+  /// @tparam Encoder functor returning the unsigned key of an element.
+  /// @tparam Key unsigned integral type of the keys.
+  ///
+  /// @param first,last iterators to the initial and final positions of the source sequence.
+  /// @param destination iterator to the initial position of the destination sequence.
+  /// @param encoder functor returning the unsigned key of an element.
+  /// @param offsets offset of the next free slot of each bucket, updated during the scatter.
+  /// @param shift position of the digit within the key.
+  /// @param mask mask of the digit bits.
+  ///
+  /// @return void.
+  template <typename SrcIT, typename DstIT, typename Encoder, typename Key>
+  void RaddixScatter(SrcIT first, const SrcIT& last, const DstIT& destination, const Encoder& encoder,
+                     std::size_t* offsets, const unsigned int shift, const Key mask)
+  {
+    for (; first != last; ++first)
+    {
+      const auto digit = (encoder(*first) >> shift) & mask;
+      *(destination + offsets[digit]++) = std::move(*first);
+    }
+  }
+
+  /// LSD Raddix Sort - Non-comparative sorting algorithm on a projected key
+  /// Proceed a stable raddix-sort on the elements contained in [begin, end[ ordered by the arithmetic key
+  /// returned by the extractor, processing DigitBits bits per pass from the least significant digit to
+  /// the most significant one.
+  /// - Keys are turned into order-preserving unsigned keys (see RaddixKey): signed integers, float and
+  ///   double are supported.
+  /// - The histograms of all the digits are computed within a single pass over the elements.
+  /// - Each pass is a counting sort between the sequence and a single buffer (ping-pong).
+  /// - Passes on which all the keys share the same digit are skipped.
   ///
-  /// @complexity O(d * N) with d max number of digits.
+  /// @complexity O(d * (N + 2^DigitBits)) with d = sizeof(key) * 8 / DigitBits, O(N) extra memory.
   ///
   /// @tparam IT type using to go through the collection.
+  /// @tparam KeyExtractor functor returning the arithmetic key of an element (e.g. a record field).
+  /// @tparam DigitBits number of bits per digit (e.g. 8 or 11).
   ///
   /// @param begin,end iterators to the initial and final positions of
   /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
   /// first and last, including the element pointed by first but not the element pointed by last.
-  /// @param base base in which the numbers are represented.
+  /// @param extractor functor returning the arithmetic key of an element.
   ///
   /// @return void.
-  template <typename IT>
-  void RaddixSort(const IT& begin, const IT& end, unsigned int base = 10)
+  template <typename IT, typename KeyExtractor, unsigned int DigitBits = 8>
+  void RaddixSort(const IT& begin, const IT& end, const KeyExtractor& extractor)
+  {
+    typedef typename std::iterator_traits<IT>::value_type Value;
+    typedef typename std::decay<typename std::result_of<KeyExtractor(const Value&)>::type>::type Projected;
+    static_assert(std::is_arithmetic<Projected>::value, "RaddixSort requires arithmetic keys");
+    static_assert(DigitBits > 0 && DigitBits <= 16, "RaddixSort digits should be within [1, 16] bits");
+    typedef typename RaddixKey<Projected>::Type Key;
+
+    const auto size = std::distance(begin, end);
+    if (size < 2)
+      return;
+
+    const auto encoder = [&extractor](const Value& value) { return RaddixKey<Projected>::Encode(extractor(value)); };
+    const std::size_t kRadix = std::size_t(1) << DigitBits;
+    const auto kMask = static_cast<Key>(kRadix - 1);
+    const unsigned int kPasses = (sizeof(Key) * 8 + DigitBits - 1) / DigitBits;
+
+    // Compute the histograms of all the digits at once
+    std::vector<std::size_t> histograms(kPasses * kRadix, 0);
+    for (auto it = begin; it != end; ++it)
+    {
+      const auto key = encoder(*it);
+      for (unsigned int pass = 0; pass < kPasses; ++pass)
+        ++histograms[pass * kRadix + ((key >> (pass * DigitBits)) & kMask)];
+    }
+
+    std::vector<Value> buffer;
+    bool isInBuffer = false;
+    for (unsigned int pass = 0; pass < kPasses; ++pass)
+    {
+      auto* offsets = &histograms[pass * kRadix];
+
+      // All the keys share the same digit: the pass would not change anything
+      if (std::find(offsets, offsets + kRadix, static_cast<std::size_t>(size)) != offsets + kRadix)
+        continue;
+
+      // Turn the histogram into bucket offsets
+      std::size_t offset = 0;
+      for (std::size_t digit = 0; digit < kRadix; ++digit)
+      {
+        const auto count = offsets[digit];
+        offsets[digit] = offset;
+        offset += count;
+      }
+
+      // Values are not required to be default constructible: the buffer starts as a copy
+      if (buffer.empty())
+        buffer.assign(begin, end);
+
+      const auto kShift = pass * DigitBits;
+      if (isInBuffer)
+        RaddixScatter(buffer.begin(), buffer.end(), begin, encoder, offsets, kShift, kMask);
+      else
+        RaddixScatter(begin, end, buffer.begin(), encoder, offsets, kShift, kMask);
+      isInBuffer = !isInBuffer;
+    }
+
+    // Bring back the elements if the last pass ended within the buffer
+    if (isInBuffer)
+      std::move(buffer.begin(), buffer.end(), begin);
+  }
+
+  /// LSD Raddix Sort - Non-comparative sorting algorithm
+  /// Proceed a stable raddix-sort on the arithmetic elements contained in [begin, end[ (signed or
+  /// unsigned integers, float and double), processing DigitBits bits per pass.
+  ///
+  /// @complexity O(d * (N + 2^DigitBits)) with d = sizeof(value) * 8 / DigitBits, O(N) extra memory.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam DigitBits number of bits per digit (e.g. 8 or 11).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT, unsigned int DigitBits = 8>
+  void RaddixSort(const IT& begin, const IT& end)
+  {
+    RaddixSort<IT, RaddixIdentity, DigitBits>(begin, end, RaddixIdentity());
+  }
+
+  /// Size under which American flag sort buckets are sorted using an insertion sort.
+  const int kAmericanFlagInsertionCutoff = 32;
+
+  /// American Flag Digits - MSD digits of arithmetic values: the bytes of their order-preserving key
+  /// (see RaddixKey), from the most significant one.
+  ///
+  /// @tparam T arithmetic type of the values.
+  template <typename T, typename Enable = void>
+  struct AmericanFlagDigits
+  {
+    typedef typename RaddixKey<T>::Type Key;
+    static const std::size_t kRadix = 256;
+
+    /// Bucket of the value at the given depth.
+    static std::size_t Digit(const T& value, const std::size_t depth)
+    { return static_cast<std::size_t>((RaddixKey<T>::Encode(value) >> ((sizeof(Key) - 1 - depth) * 8)) & 0xFF); }
+
+    /// Whether the values of the bucket are all equivalent once their digits up to depth are known.
+    static bool IsComplete(const std::size_t, const std::size_t depth) { return depth + 1 >= sizeof(Key); }
+
+    /// Order of two values sharing their digits before depth.
+    static bool Less(const T& a, const T& b, const std::size_t)
+    { return RaddixKey<T>::Encode(a) < RaddixKey<T>::Encode(b); }
+  };
+
+  /// American Flag Digits - MSD digits of byte strings: the characters as unsigned bytes, the shorter
+  /// strings coming first within the dedicated bucket 0.
+  template <typename CharT, typename Traits, typename Alloc>
+  struct AmericanFlagDigits<std::basic_string<CharT, Traits, Alloc>, void>
+  {
+    static_assert(sizeof(CharT) == 1, "AmericanFlagSort supports only byte strings");
+    typedef std::basic_string<CharT, Traits, Alloc> String;
+    static const std::size_t kRadix = 257;
+
+    /// Bucket of the string at the given depth: 0 if the string is over, 1 + character otherwise.
+    static std::size_t Digit(const String& value, const std::size_t depth)
+    { return depth < value.size() ? 1 + static_cast<unsigned char>(value[depth]) : 0; }
+
+    /// Whether the strings of the bucket are all equal once their characters up to depth are known.
+    static bool IsComplete(const std::size_t digit, const std::size_t) { return digit == 0; }
+
+    /// Order of two strings sharing their characters before depth.
+    static bool Less(const String& a, const String& b, const std::size_t depth)
+    { return a.compare(depth, String::npos, b, depth, String::npos) < 0; }
+  };
+
+  /// American Flag Partition - Distribute in-place the elements contained in [begin, end[ into the
+  /// buckets of their digit at the given depth, by cycling each misplaced element to the next free slot
+  /// of its bucket.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Digits digits traits of the elements (see AmericanFlagDigits).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be partitioned. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depth position of the digit.
+  /// @param bounds filled with the Digits::kRadix + 1 offsets of the buckets within the sequence.
+  ///
+  /// @return void.
+  template <typename IT, typename Digits>
+  void AmericanFlagPartition(const IT& begin, const IT& end, const std::size_t depth, std::size_t* bounds)
+  {
+    const std::size_t kRadix = Digits::kRadix;
+
+    // Count the elements of each bucket, then turn the counts into bucket offsets
+    std::fill(bounds, bounds + kRadix + 1, 0);
+    for (auto it = begin; it != end; ++it)
+      ++bounds[Digits::Digit(*it, depth) + 1];
+    for (std::size_t digit = 0; digit < kRadix; ++digit)
+      bounds[digit + 1] += bounds[digit];
+
+    // Permute the elements until each bucket only holds its own digit
+    std::size_t heads[Digits::kRadix];
+    std::copy(bounds, bounds + kRadix, heads);
+    for (std::size_t digit = 0; digit < kRadix; ++digit)
+    {
+      while (heads[digit] < bounds[digit + 1])
+      {
+        const auto current = begin + heads[digit];
+        const auto currentDigit = Digits::Digit(*current, depth);
+        if (currentDigit == digit)
+          ++heads[digit];
+        else
+          std::iter_swap(current, begin + heads[currentDigit]++);
+      }
+    }
+  }
+
+  /// American Flag Insertion Sort - Insertion sort of elements sharing their digits before depth.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Digits digits traits of the elements (see AmericanFlagDigits).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depth number of leading digits shared by all the elements.
+  ///
+  /// @return void.
+  template <typename IT, typename Digits>
+  void AmericanFlagInsertionSort(const IT& begin, const IT& end, const std::size_t depth)
   {
     if (std::distance(begin, end) < 2)
       return;
 
-    // Create a bucket for each possible value of a digit
-    std::vector<std::queue<typename std::iterator_traits<IT>::value_type>> buckets(base);
+    for (auto it = begin + 1; it != end; ++it)
+    {
+      auto value = std::move(*it);
+      auto hole = it;
+      for (; hole != begin && Digits::Less(value, *(hole - 1), depth); --hole)
+        *hole = std::move(*(hole - 1));
+      *hole = std::move(value);
+    }
+  }
 
-    // For all possible digit
-    for (size_t powBase = 1;
-         powBase < std::numeric_limits<typename std::iterator_traits<IT>::value_type>::max();
-         powBase *= base)
+  /// American Flag Sort Loop - Partition the sequence on the digit at the given depth, recurse on all the
+  /// buckets but the biggest one and loop on the biggest one with the next digit: the recursion depth is
+  /// bounded by log2(N).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Digits digits traits of the elements (see AmericanFlagDigits).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param depth number of leading digits shared by all the elements.
+  /// @param insertionCutoff size under which the sequence is sorted using an insertion sort.
+  ///
+  /// @return void.
+  template <typename IT, typename Digits>
+  void AmericanFlagSortLoop(IT begin, IT end, std::size_t depth, const int insertionCutoff)
+  {
+    const std::size_t kRadix = Digits::kRadix;
+    std::size_t bounds[Digits::kRadix + 1];
+
+    while (std::distance(begin, end) > insertionCutoff)
     {
-      // Push each number into the bucket of its digit value
-      for (auto it = begin; it != end; ++it)
-        buckets[static_cast<int>(*it / powBase) % base].push(*it);
-
-      // Dequeu back all the values
-      auto itSrc = begin;
-      for (auto it = buckets.begin(); it != buckets.end(); ++it)
-        while (!it->empty())
-        {
-          *(itSrc++) = it->front();
-          it->pop();
-        }
+      AmericanFlagPartition<IT, Digits>(begin, end, depth, bounds);
+
+      // Find the biggest bucket still to be sorted
+      auto biggest = kRadix;
+      for (std::size_t digit = 0; digit < kRadix; ++digit)
+      {
+        const auto size = bounds[digit + 1] - bounds[digit];
+        if (size > 1 && !Digits::IsComplete(digit, depth) &&
+            (biggest == kRadix || size > bounds[biggest + 1] - bounds[biggest]))
+          biggest = digit;
+      }
+      if (biggest == kRadix)
+        return;
+
+      for (std::size_t digit = 0; digit < kRadix; ++digit)
+      {
+        if (digit == biggest || bounds[digit + 1] - bounds[digit] < 2 || Digits::IsComplete(digit, depth))
+          continue;
+        AmericanFlagSortLoop<IT, Digits>(begin + bounds[digit], begin + bounds[digit + 1], depth + 1, insertionCutoff);
+      }
+
+      end = begin + bounds[biggest + 1];
+      begin = begin + bounds[biggest];
+      ++depth;
     }
+
+    AmericanFlagInsertionSort<IT, Digits>(begin, end, depth);
+  }
+
+  /// American Flag Sort - In-place MSD raddix sort
+  /// Proceed an in-place raddix-sort on the elements contained in [begin, end[ processing one byte per
+  /// level, from the most significant digit: each level distributes the elements into their 256 buckets by
+  /// permutation cycles, then each bucket is sorted on the next digit. Small buckets are sorted using an
+  /// insertion sort.
+  /// Supports arithmetic values (see RaddixKey) and variable-length byte strings (std::string).
+  ///
+  /// @warning Not stable.
+  ///
+  /// @complexity O(N * d) with d the number of digits (bytes) needed to tell the keys apart, O(log N)
+  /// extra memory.
+  ///
+  /// @tparam IT type using to go through the collection.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT>
+  void AmericanFlagSort(const IT& begin, const IT& end)
+  {
+    if (std::distance(begin, end) < 2)
+      return;
+
+    typedef AmericanFlagDigits<typename std::iterator_traits<IT>::value_type> Digits;
+    AmericanFlagSortLoop<IT, Digits>(begin, end, 0, kAmericanFlagInsertionCutoff);
   }
 }
 
@@ -0,0 +1,228 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_SORT_HXX
+#define MODULE_SORT_SORT_HXX
+
+#include <insertion.hxx>
+#include <natural_merge.hxx>
+#include <quick.hxx>
+#include <raddix.hxx>
+#include <sorting_network.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// Minimal average length of the ascending (or descending) runs for Sort to pick the natural merge sort.
+  const int kSortPresortedRunLength = 32;
+
+  /// Number of elements sampled by Sort to estimate the ratio of duplicates.
+  const int kSortDuplicateSampleSize = 256;
+
+  /// Ratio of duplicates within the sample (out of 1) from which Sort picks the three-way quick sort.
+  const double kSortDuplicateRatio = 0.25;
+
+  /// Size from which Sort picks the raddix sorts on arithmetic values and strings.
+  const int kSortRaddixMinSize = 1 << 10;
+
+  /// Sort Engine - Algorithm picked by Sort.
+  enum class SortEngine
+  {
+    None,           ///< Less than two elements: nothing to sort
+    SortingNetwork, ///< Small sequence of arithmetic values (see TrySortingNetwork)
+    Insertion,      ///< Small sequence (see InsertionSort)
+    NaturalMerge,   ///< Long ascending or descending runs (see NaturalMergeSort)
+    Raddix,         ///< Arithmetic values (see RaddixSort)
+    AmericanFlag,   ///< Strings (see AmericanFlagSort)
+    QuickSort3Way,  ///< Many duplicates (see QuickSort3Way)
+    QuickSort       ///< Anything else (see QuickSort)
+  };
+
+  /// @return name of the engine.
+  inline const char* SortEngineName(const SortEngine engine)
+  {
+    switch (engine)
+    {
+      case SortEngine::None:           return "None";
+      case SortEngine::SortingNetwork: return "SortingNetwork";
+      case SortEngine::Insertion:      return "Insertion";
+      case SortEngine::NaturalMerge:   return "NaturalMerge";
+      case SortEngine::Raddix:         return "Raddix";
+      case SortEngine::AmericanFlag:   return "AmericanFlag";
+      case SortEngine::QuickSort3Way:  return "QuickSort3Way";
+      case SortEngine::QuickSort:      return "QuickSort";
+    }
+    return "Unknown";
+  }
+
+  /// Sort Stats - Input characteristics measured by Sort and engine picked accordingly.
+  struct SortStats
+  {
+    SortStats() : engine(SortEngine::None), size(0), scanned(0), descents(0), ascents(0), sampleSize(0),
+                  sampleDuplicates(0) {}
+
+    SortEngine engine;            ///< Engine which sorted the sequence
+    std::size_t size;             ///< Number of elements
+    std::size_t scanned;          ///< Elements scanned for runs, the scan stops once runs are too short
+    std::size_t descents;         ///< Neighbours out of order within the scanned elements
+    std::size_t ascents;          ///< Neighbours strictly in order within the scanned elements
+    std::size_t sampleSize;       ///< Elements sampled for duplicates, 0 if not sampled
+    std::size_t sampleDuplicates; ///< Elements of the sorted sample equivalent to their predecessor
+  };
+
+  /// Sort Raddix Engine - Whether a raddix sort applies: integers, 32 / 64 bits floating points ordered by a
+  /// standard functor, or strings in lexicographical order.
+  template <typename Value, typename Compare>
+  struct SortRaddixEngine : std::integral_constant<SortEngine,
+    (std::is_integral<Value>::value || (std::is_floating_point<Value>::value && (sizeof(Value) == 4 ||
+                                                                                 sizeof(Value) == 8))) &&
+    SortingNetworkOrder<Compare, Value>::value != 0 ? SortEngine::Raddix :
+    std::is_same<Value, std::string>::value && std::is_same<Compare, std::less<std::string>>::value ?
+      SortEngine::AmericanFlag : SortEngine::None>
+  {};
+
+  /// Sort Raddix - No raddix sort applies.
+  template <typename IT, typename Compare>
+  void SortRaddix(const IT&, const IT&, std::integral_constant<SortEngine, SortEngine::None>) {}
+
+  /// Sort Raddix - LSD raddix sort on arithmetic values, reversed for an inverse order.
+  template <typename IT, typename Compare>
+  void SortRaddix(const IT& begin, const IT& end, std::integral_constant<SortEngine, SortEngine::Raddix>)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    RaddixSort<IT>(begin, end);
+    if (SortingNetworkOrder<Compare, Value>::value < 0)
+      std::reverse(begin, end);
+  }
+
+  /// Sort Raddix - MSD raddix sort on strings.
+  template <typename IT, typename Compare>
+  void SortRaddix(const IT& begin, const IT& end, std::integral_constant<SortEngine, SortEngine::AmericanFlag>)
+  {
+    AmericanFlagSort<IT>(begin, end);
+  }
+
+  /// Sort - Proceed an in-place sort on the elements using the engine best suited to the sequence:
+  /// - small sequences: sorting network on arithmetic values, insertion sort otherwise;
+  /// - long runs (presorted, reversed or concatenated sequences): natural merge sort, O(N) on sorted input;
+  /// - arithmetic values (LSD) and strings (MSD, std::less only) from kSortRaddixMinSize elements: raddix sorts;
+  /// - many duplicates within a sample: three-way quick sort;
+  /// - otherwise: quick sort.
+  /// Runs are counted by a scan stopping as soon as they are too short on average, and duplicates are estimated
+  /// on kSortDuplicateSampleSize evenly spaced elements: measuring the input costs a small fraction of a sort.
+  ///
+  /// @warning this method is not stable (does not keep order with element of the same value).
+  ///
+  /// @complexity O(N log N) comparisons in the worst case, O(N) on sorted sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare strict functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  /// @param stats if not null, filled with the measured characteristics and the engine picked.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void Sort(const IT& begin, const IT& end, SortStats* stats = nullptr)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    typedef SortRaddixEngine<Value, Compare> RaddixEngine;
+
+    SortStats localStats;
+    auto& result = stats ? *stats : localStats;
+    result = SortStats();
+
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+    result.size = static_cast<std::size_t>(distance);
+
+    // Small sequences
+    if (distance <= kSortingNetworkMaxSize && TrySortingNetwork<IT, Compare>(begin, end))
+    {
+      result.engine = SortEngine::SortingNetwork;
+      return;
+    }
+    if (distance <= kQuickSortInsertionCutoff)
+    {
+      InsertionSort<IT, Compare>(begin, end);
+      result.engine = SortEngine::Insertion;
+      return;
+    }
+
+    // Presortedness: count the descents and the ascents until both are too frequent for a natural merge
+    const auto maxRuns = static_cast<std::size_t>(distance / kSortPresortedRunLength);
+    auto it = begin + 1;
+    for (; it != end && (result.descents <= maxRuns || result.ascents <= maxRuns); ++it)
+    {
+      result.descents += Compare()(*it, *(it - 1)) ? 1 : 0;
+      result.ascents += Compare()(*(it - 1), *it) ? 1 : 0;
+    }
+    result.scanned = static_cast<std::size_t>(std::distance(begin, it));
+    if (it == end && (result.descents <= maxRuns || result.ascents <= maxRuns))
+    {
+      NaturalMergeSort<IT, Compare>(begin, end);
+      result.engine = SortEngine::NaturalMerge;
+      return;
+    }
+
+    // Key type: raddix sorts
+    if (RaddixEngine::value != SortEngine::None && distance >= kSortRaddixMinSize)
+    {
+      SortRaddix<IT, Compare>(begin, end, typename RaddixEngine::type());
+      result.engine = RaddixEngine::value;
+      return;
+    }
+
+    // Duplicates: sort a sample of evenly spaced elements and count the equivalent neighbours
+    const auto sampleSize = std::min(distance, kSortDuplicateSampleSize);
+    std::vector<Value> sample;
+    sample.reserve(static_cast<std::size_t>(sampleSize));
+    for (auto i = 0; i < sampleSize; ++i)
+      sample.push_back(*(begin + static_cast<int>(static_cast<long long>(i) * distance / sampleSize)));
+    QuickSort<typename std::vector<Value>::iterator, Compare>(sample.begin(), sample.end());
+
+    result.sampleSize = sample.size();
+    for (std::size_t i = 1; i < sample.size(); ++i)
+      result.sampleDuplicates += Compare()(sample[i - 1], sample[i]) ? 0 : 1;
+
+    if (result.sampleDuplicates >= kSortDuplicateRatio * result.sampleSize)
+    {
+      QuickSort3Way<IT, Compare>(begin, end);
+      result.engine = SortEngine::QuickSort3Way;
+      return;
+    }
+
+    QuickSort<IT, Compare>(begin, end);
+    result.engine = SortEngine::QuickSort;
+  }
+}
+
+#endif // MODULE_SORT_SORT_HXX
@@ -0,0 +1,514 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_SORTING_NETWORK_HXX
+#define MODULE_SORT_SORTING_NETWORK_HXX
+
+#include <insertion.hxx>
+#include <traits.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace SHA_Sort
+{
+  /// Size up to which sorting network kernels are used as base case by the hybrid sorts.
+  const int kSortingNetworkMaxSize = 64;
+
+  /// Sorting Network Exchange - Compare-exchange of two elements: conditional moves for arithmetic values.
+  template <typename IT, typename Compare>
+  void SortingNetworkExchange(const IT& a, const IT& b, std::true_type)
+  {
+    const auto first = *a;
+    const auto second = *b;
+    const bool isSwapped = Compare()(second, first);
+    *a = isSwapped ? second : first;
+    *b = isSwapped ? first : second;
+  }
+
+  /// Sorting Network Exchange - Compare-exchange of two elements: swap of generic values.
+  template <typename IT, typename Compare>
+  void SortingNetworkExchange(const IT& a, const IT& b, std::false_type)
+  {
+    if (Compare()(*b, *a))
+      std::iter_swap(a, b);
+  }
+
+  /// Sorting Network - Proceed an in-place sort on the elements through Batcher's odd-even merge
+  /// network: the sequence of compare-exchanges only depends on the number of elements, so that
+  /// arithmetic values are sorted without any data-dependent branch.
+  ///
+  /// @warning Not stable.
+  ///
+  /// @complexity O(N log^2 N) compare-exchanges: to be used on small sequences.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type (std::less in order, std::greater for inverse order).
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void SortingNetwork(const IT& begin, const IT& end)
+  {
+    typedef std::is_arithmetic<typename std::iterator_traits<IT>::value_type> IsArithmetic;
+
+    const auto distance = static_cast<const int>(std::distance(begin, end));
+    if (distance < 2)
+      return;
+
+    // Merge sorted blocks of p elements, comparing elements k apart within each block pair
+    for (int p = 1; p < distance; p <<= 1)
+      for (int k = p; k >= 1; k >>= 1)
+        for (int j = k % p; j + k < distance; j += 2 * k)
+          for (int i = 0; i < std::min(k, distance - j - k); ++i)
+            if (((i + j) ^ (i + j + k)) < 2 * p) // Both elements belong to the same block of 2p elements
+              SortingNetworkExchange<IT, Compare>(begin + (i + j), begin + (i + j + k), IsArithmetic());
+  }
+
+  /// Sorting Network Order - Direction in which a functor orders arithmetic values:
+  /// 1 for std::less / std::less_equal, -1 for std::greater / std::greater_equal, 0 otherwise.
+  ///
+  /// @tparam Compare functor type.
+  /// @tparam Value type of the compared values.
+  template <typename Compare, typename Value>
+  struct SortingNetworkOrder : std::integral_constant<int,
+    !std::is_arithmetic<Value>::value || std::is_same<Value, bool>::value ? 0 :
+    std::is_same<Compare, std::less<Value>>::value || std::is_same<Compare, std::less_equal<Value>>::value ? 1 :
+    std::is_same<Compare, std::greater<Value>>::value || std::is_same<Compare, std::greater_equal<Value>>::value ? -1 : 0>
+  {};
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#if defined(__AVX2__)
+  typedef __m256i SortingNetworkRegister;
+  const int kSortingNetworkRegisterSlots = 8; // 32 bits slots per register
+
+  inline SortingNetworkRegister SortingNetworkLoad(const void* data)
+  { return _mm256_loadu_si256(static_cast<const __m256i*>(data)); }
+
+  inline void SortingNetworkStore(void* data, const SortingNetworkRegister value)
+  { _mm256_storeu_si256(static_cast<__m256i*>(data), value); }
+
+  /// Register moving the lanes of slotsPerLane slots according to lanePermutation.
+  inline SortingNetworkRegister SortingNetworkPermutation(const int* lanePermutation, const int slotsPerLane)
+  {
+    std::int32_t slots[kSortingNetworkRegisterSlots];
+    for (int slot = 0; slot < kSortingNetworkRegisterSlots; ++slot)
+      slots[slot] = lanePermutation[slot / slotsPerLane] * slotsPerLane + slot % slotsPerLane;
+    return SortingNetworkLoad(slots);
+  }
+
+  inline SortingNetworkRegister SortingNetworkShuffle(const SortingNetworkRegister value,
+                                                      const SortingNetworkRegister permutation)
+  { return _mm256_permutevar8x32_epi32(value, permutation); }
+
+  inline SortingNetworkRegister SortingNetworkBlend(const SortingNetworkRegister a, const SortingNetworkRegister b,
+                                                    const SortingNetworkRegister mask)
+  { return _mm256_blendv_epi8(a, b, mask); }
+
+  /// Sorting Network Lanes - Vector min / max of the supported value types.
+  template <typename T>
+  struct SortingNetworkLanes;
+
+  template <>
+  struct SortingNetworkLanes<std::int32_t>
+  {
+    static const int kSlots = 1;
+    static __m256i Min(const __m256i a, const __m256i b) { return _mm256_min_epi32(a, b); }
+    static __m256i Max(const __m256i a, const __m256i b) { return _mm256_max_epi32(a, b); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<std::uint32_t>
+  {
+    static const int kSlots = 1;
+    static __m256i Min(const __m256i a, const __m256i b) { return _mm256_min_epu32(a, b); }
+    static __m256i Max(const __m256i a, const __m256i b) { return _mm256_max_epu32(a, b); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<float>
+  {
+    static const int kSlots = 1;
+    static __m256i Min(const __m256i a, const __m256i b)
+    { return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+    static __m256i Max(const __m256i a, const __m256i b)
+    { return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<double>
+  {
+    static const int kSlots = 2;
+    static __m256i Min(const __m256i a, const __m256i b)
+    { return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b))); }
+    static __m256i Max(const __m256i a, const __m256i b)
+    { return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b))); }
+  };
+#else
+  typedef __m128i SortingNetworkRegister;
+  const int kSortingNetworkRegisterSlots = 4; // 32 bits slots per register
+
+  inline SortingNetworkRegister SortingNetworkLoad(const void* data)
+  { return _mm_loadu_si128(static_cast<const __m128i*>(data)); }
+
+  inline void SortingNetworkStore(void* data, const SortingNetworkRegister value)
+  { _mm_storeu_si128(static_cast<__m128i*>(data), value); }
+
+  /// Register moving the lanes of slotsPerLane slots according to lanePermutation (byte indices).
+  inline SortingNetworkRegister SortingNetworkPermutation(const int* lanePermutation, const int slotsPerLane)
+  {
+    std::uint8_t bytes[kSortingNetworkRegisterSlots * 4];
+    for (int byte = 0; byte < kSortingNetworkRegisterSlots * 4; ++byte)
+    {
+      const auto slot = byte / 4;
+      const auto source = lanePermutation[slot / slotsPerLane] * slotsPerLane + slot % slotsPerLane;
+      bytes[byte] = static_cast<std::uint8_t>(source * 4 + byte % 4);
+    }
+    return SortingNetworkLoad(bytes);
+  }
+
+  inline SortingNetworkRegister SortingNetworkShuffle(const SortingNetworkRegister value,
+                                                      const SortingNetworkRegister permutation)
+  { return _mm_shuffle_epi8(value, permutation); }
+
+  inline SortingNetworkRegister SortingNetworkBlend(const SortingNetworkRegister a, const SortingNetworkRegister b,
+                                                    const SortingNetworkRegister mask)
+  { return _mm_blendv_epi8(a, b, mask); }
+
+  /// Sorting Network Lanes - Vector min / max of the supported value types.
+  template <typename T>
+  struct SortingNetworkLanes;
+
+  template <>
+  struct SortingNetworkLanes<std::int32_t>
+  {
+    static const int kSlots = 1;
+    static __m128i Min(const __m128i a, const __m128i b) { return _mm_min_epi32(a, b); }
+    static __m128i Max(const __m128i a, const __m128i b) { return _mm_max_epi32(a, b); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<std::uint32_t>
+  {
+    static const int kSlots = 1;
+    static __m128i Min(const __m128i a, const __m128i b) { return _mm_min_epu32(a, b); }
+    static __m128i Max(const __m128i a, const __m128i b) { return _mm_max_epu32(a, b); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<float>
+  {
+    static const int kSlots = 1;
+    static __m128i Min(const __m128i a, const __m128i b)
+    { return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+    static __m128i Max(const __m128i a, const __m128i b)
+    { return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+  };
+
+  template <>
+  struct SortingNetworkLanes<double>
+  {
+    static const int kSlots = 2;
+    static __m128i Min(const __m128i a, const __m128i b)
+    { return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))); }
+    static __m128i Max(const __m128i a, const __m128i b)
+    { return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b))); }
+  };
+#endif
+
+  /// Register with the lanes of slotsPerLane slots set to all ones where laneMask is true.
+  inline SortingNetworkRegister SortingNetworkMask(const bool* laneMask, const int slotsPerLane)
+  {
+    std::int32_t slots[kSortingNetworkRegisterSlots];
+    for (int slot = 0; slot < kSortingNetworkRegisterSlots; ++slot)
+      slots[slot] = laneMask[slot / slotsPerLane] ? -1 : 0;
+    return SortingNetworkLoad(slots);
+  }
+
+  /// Sorting Network Kernel - Vectorized bitonic sorting network on a block of Size values
+  /// (8, 16, 32 or 64) kept within registers.
+  /// - Compare-exchanges between elements of different registers are plain vector min / max.
+  /// - Compare-exchanges within a register shuffle its lanes, then blend the min / max.
+  ///
+  /// @warning NaN values are not supported.
+  ///
+  /// @tparam T value type (int32, uint32, float or double).
+  /// @tparam Size number of values of the block.
+  ///
+  /// @param data block of values to be sorted in order.
+  ///
+  /// @return void.
+  template <typename T, int Size>
+  void SortingNetworkKernel(T* data)
+  {
+    typedef SortingNetworkLanes<T> Lanes;
+    const int kSlots = Lanes::kSlots;
+    const int kLanes = kSortingNetworkRegisterSlots / kSlots;
+    const int kRegisters = Size / kLanes;
+    static_assert(Size % kLanes == 0 && Size <= kSortingNetworkMaxSize, "Unsupported sorting network size");
+
+    // Lane shuffles and masks of the in-register steps, indexed by log2(j) (and log2(k))
+    SortingNetworkRegister partners[3];
+    SortingNetworkRegister upperMasks[3];
+    SortingNetworkRegister mixedMasks[3][3];
+    for (int jLog = 0; (1 << jLog) < kLanes; ++jLog)
+    {
+      const int j = 1 << jLog;
+      int permutation[kSortingNetworkRegisterSlots];
+      bool upper[kSortingNetworkRegisterSlots];
+      for (int lane = 0; lane < kLanes; ++lane)
+      {
+        permutation[lane] = lane ^ j;
+        upper[lane] = (lane & j) != 0;
+      }
+      partners[jLog] = SortingNetworkPermutation(permutation, kSlots);
+      upperMasks[jLog] = SortingNetworkMask(upper, kSlots);
+
+      // Blocks of k lanes sorted in alternate directions (k < kLanes)
+      for (int kLog = jLog + 1; (1 << kLog) < kLanes; ++kLog)
+      {
+        bool takeMax[kSortingNetworkRegisterSlots];
+        for (int lane = 0; lane < kLanes; ++lane)
+          takeMax[lane] = ((lane & j) != 0) != ((lane & (1 << kLog)) != 0);
+        mixedMasks[jLog][kLog] = SortingNetworkMask(takeMax, kSlots);
+      }
+    }
+
+    SortingNetworkRegister values[kRegisters];
+    for (int r = 0; r < kRegisters; ++r)
+      values[r] = SortingNetworkLoad(data + r * kLanes);
+
+    // Bitonic network: merge bitonic blocks of k elements, comparing elements j apart
+    for (int k = 2, kLog = 1; k <= Size; k <<= 1, ++kLog)
+    {
+      for (int j = k >> 1, jLog = kLog - 1; j > 0; j >>= 1, --jLog)
+      {
+        if (j >= kLanes)
+        {
+          // Elements j apart lie within different registers
+          const int step = j / kLanes;
+          for (int block = 0; block + step < kRegisters; block += 2 * step)
+          {
+            for (int r = block; r < block + step; ++r)
+            {
+              const auto low = Lanes::Min(values[r], values[r + step]);
+              const auto high = Lanes::Max(values[r], values[r + step]);
+              const bool isDescending = ((r * kLanes) & k) != 0;
+              values[r] = isDescending ? high : low;
+              values[r + step] = isDescending ? low : high;
+            }
+          }
+        }
+        else
+        {
+          // Elements j apart lie within the same register
+          for (int r = 0; r < kRegisters; ++r)
+          {
+            const auto partner = SortingNetworkShuffle(values[r], partners[jLog]);
+            const auto low = Lanes::Min(values[r], partner);
+            const auto high = Lanes::Max(values[r], partner);
+            if (k < kLanes)
+              values[r] = SortingNetworkBlend(low, high, mixedMasks[jLog][kLog]);
+            else if (((r * kLanes) & k) != 0)
+              values[r] = SortingNetworkBlend(high, low, upperMasks[jLog]);
+            else
+              values[r] = SortingNetworkBlend(low, high, upperMasks[jLog]);
+          }
+        }
+      }
+    }
+
+    for (int r = 0; r < kRegisters; ++r)
+      SortingNetworkStore(data + r * kLanes, values[r]);
+  }
+
+  /// Sorting Network Vectorized - Sort up to kSortingNetworkMaxSize values in order: the values are
+  /// padded with the biggest value up to the next supported kernel size.
+  ///
+  /// @tparam T value type (int32, uint32, float or double).
+  ///
+  /// @param data values to be sorted in order.
+  /// @param size number of values.
+  ///
+  /// @return void.
+  template <typename T>
+  void SortingNetworkVectorized(T* data, const int size)
+  {
+    // A few compare-exchanges are cheaper than the copies to and from the padded block
+    if (size < 4)
+    {
+      SortingNetwork<T*>(data, data + size);
+      return;
+    }
+
+    const auto kPadding = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                               : std::numeric_limits<T>::max();
+    T block[kSortingNetworkMaxSize];
+    std::copy(data, data + size, block);
+
+    if (size <= 8)
+    {
+      std::fill(block + size, block + 8, kPadding);
+      SortingNetworkKernel<T, 8>(block);
+    }
+    else if (size <= 16)
+    {
+      std::fill(block + size, block + 16, kPadding);
+      SortingNetworkKernel<T, 16>(block);
+    }
+    else if (size <= 32)
+    {
+      std::fill(block + size, block + 32, kPadding);
+      SortingNetworkKernel<T, 32>(block);
+    }
+    else
+    {
+      std::fill(block + size, block + 64, kPadding);
+      SortingNetworkKernel<T, 64>(block);
+    }
+
+    std::copy(block, block + size, data);
+  }
+
+  /// Sorting Network Has Kernel - Whether a vectorized kernel handles the value type.
+  template <typename T>
+  struct SortingNetworkHasKernel : std::integral_constant<bool,
+    std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value ||
+    std::is_same<T, float>::value || std::is_same<T, double>::value>
+  {};
+#else
+  /// Sorting Network Has Kernel - No vectorized kernel without SSE4.1 / AVX2.
+  template <typename T>
+  struct SortingNetworkHasKernel : std::false_type {};
+#endif
+
+  /// Sorting Network Sort - Vectorized kernel on contiguous int32, uint32, float and double values.
+  template <typename IT>
+  void SortingNetworkSort(const IT& begin, const IT& end, std::true_type)
+  {
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    SortingNetworkVectorized(&*begin, static_cast<int>(std::distance(begin, end)));
+#else
+    SortingNetwork<IT>(begin, end);
+#endif
+  }
+
+  /// Sorting Network Sort - Scalar fallback: branchless odd-even merge network.
+  template <typename IT>
+  void SortingNetworkSort(const IT& begin, const IT& end, std::false_type)
+  {
+    SortingNetwork<IT>(begin, end);
+  }
+
+  /// Sorting Network Sort - No network applies on the functor / value type.
+  ///
+  /// @return false.
+  template <typename IT>
+  bool SortingNetworkSort(const IT&, const IT&, std::integral_constant<int, 0>)
+  {
+    return false;
+  }
+
+  /// Sorting Network Sort - Sort the sequence in order through the best available network.
+  ///
+  /// @return true.
+  template <typename IT>
+  bool SortingNetworkSort(const IT& begin, const IT& end, std::integral_constant<int, 1>)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    SortingNetworkSort(begin, end, std::integral_constant<bool,
+      IsContiguousIterator<IT>::value && SortingNetworkHasKernel<Value>::value>());
+    return true;
+  }
+
+  /// Sorting Network Sort - Sort the sequence in inverse order: sorted in order, then reversed.
+  ///
+  /// @return true.
+  template <typename IT>
+  bool SortingNetworkSort(const IT& begin, const IT& end, std::integral_constant<int, -1>)
+  {
+    SortingNetworkSort(begin, end, std::integral_constant<int, 1>());
+    std::reverse(begin, end);
+    return true;
+  }
+
+  /// Try Sorting Network - Sort a small sequence of arithmetic values ordered by a standard functor
+  /// (std::less, std::less_equal, std::greater, std::greater_equal) using a sorting network:
+  /// vectorized kernels on int32, uint32, float and double with AVX2 / SSE4.1, scalar network otherwise.
+  ///
+  /// @remark Equal arithmetic values cannot be told apart: the lack of stability is not observable
+  /// (-0.0 and +0.0 excepted).
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return true if the sequence has been sorted, false if no network applies (other value types or
+  /// functors, more than kSortingNetworkMaxSize elements).
+  template <typename IT, typename Compare>
+  bool TrySortingNetwork(const IT& begin, const IT& end)
+  {
+    typedef typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type Value;
+    const auto distance = std::distance(begin, end);
+    if (distance > kSortingNetworkMaxSize)
+      return false;
+    if (distance < 2)
+      return SortingNetworkOrder<Compare, Value>::value != 0;
+
+    return SortingNetworkSort(begin, end, std::integral_constant<int, SortingNetworkOrder<Compare, Value>::value>());
+  }
+
+  /// Small Sort - Base case of the hybrid sorts: sorting network if applicable (see TrySortingNetwork),
+  /// insertion sort otherwise.
+  ///
+  /// @tparam IT type using to go through the collection.
+  /// @tparam Compare functor type.
+  ///
+  /// @param begin,end iterators to the initial and final positions of
+  /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+  /// first and last, including the element pointed by first but not the element pointed by last.
+  ///
+  /// @return void.
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  void SmallSort(const IT& begin, const IT& end)
+  {
+    if (!TrySortingNetwork<IT, Compare>(begin, end))
+      InsertionSort<IT, Compare>(begin, end);
+  }
+}
+
+#endif // MODULE_SORT_SORTING_NETWORK_HXX
@@ -0,0 +1,311 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_THREAD_POOL_HXX
+#define MODULE_SORT_THREAD_POOL_HXX
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// @class ThreadPool
+  ///
+  /// Work-stealing pool of threads used to run fork-join algorithms.
+  /// Each worker owns a queue of tasks: tasks forked by a worker are pushed into its own queue and
+  /// popped back in LIFO order (cache friendly depth-first processing), while idle workers steal the
+  /// oldest tasks (i.e. the biggest ones in divide and conquer algorithms) from the other queues.
+  /// Threads outside of the pool share an additional queue.
+  ///
+  /// @remark threads waiting for a task group also run pending tasks instead of blocking: nested
+  /// fork-join calls never dead-lock, even on a pool without any worker.
+  class ThreadPool
+  {
+    typedef std::function<void()> Task;
+
+    public:
+      /// Construct the pool and start its workers.
+      ///
+      /// @param threadCount number of worker threads, 0 to let waiting threads run all the tasks.
+      explicit ThreadPool(unsigned int threadCount = std::thread::hardware_concurrency())
+        : queues(threadCount + 1), pendingTasks(0), isStopping(false)
+      {
+        for (auto& queue : this->queues)
+          queue.reset(new WorkerQueue());
+
+        for (unsigned int i = 0; i < threadCount; ++i)
+          this->workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+      }
+
+      /// Stop the workers once they are idle and join them.
+      ~ThreadPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->sleepMutex);
+          this->isStopping = true;
+        }
+        this->sleepCondition.notify_all();
+
+        for (auto& worker : this->workers)
+          worker.join();
+      }
+
+      /// @return number of worker threads.
+      unsigned int Size() const { return static_cast<unsigned int>(this->workers.size()); }
+
+      /// Push a task within the queue of the calling thread.
+      ///
+      /// @param task callable to be run by the pool.
+      ///
+      /// @return void.
+      void Submit(Task task)
+      {
+        const auto index = this->OwnQueueIndex();
+
+        // Count the task first: the counter never underestimates the queued tasks
+        ++this->pendingTasks;
+        {
+          std::lock_guard<std::mutex> lock(this->queues[index]->mutex);
+          this->queues[index]->tasks.push_back(std::move(task));
+        }
+
+        // Wake up a sleeping worker
+        {
+          std::lock_guard<std::mutex> lock(this->sleepMutex);
+        }
+        this->sleepCondition.notify_one();
+      }
+
+      /// Run a single pending task: the most recent one of the calling thread queue if any,
+      /// or a task stolen from the other queues.
+      ///
+      /// @return true if a task has been run, false if no task was pending.
+      bool RunPendingTask()
+      {
+        Task task;
+        if (!this->PopTask(task))
+          return false;
+
+        task();
+        return true;
+      }
+
+    private:
+      ThreadPool(const ThreadPool&);            // Not implemented
+      ThreadPool& operator=(const ThreadPool&); // Not implemented
+
+      struct WorkerQueue
+      {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+      };
+
+      // Pool and queue index of the calling thread (nullptr outside of any pool)
+      static ThreadPool*& CurrentPool() { static thread_local ThreadPool* pool = nullptr; return pool; }
+      static unsigned int& CurrentIndex() { static thread_local unsigned int index = 0; return index; }
+
+      // Queue of the calling thread: the last queue is shared by the threads outside of the pool
+      unsigned int OwnQueueIndex() const
+      {
+        return (CurrentPool() == this) ? CurrentIndex() : static_cast<unsigned int>(this->workers.size());
+      }
+
+      bool PopTask(Task& task)
+      {
+        if (this->pendingTasks.load() <= 0)
+          return false;
+
+        const auto kQueueCount = static_cast<unsigned int>(this->queues.size());
+        const auto ownIndex = this->OwnQueueIndex();
+
+        // Pop the most recent task of the own queue
+        {
+          std::lock_guard<std::mutex> lock(this->queues[ownIndex]->mutex);
+          auto& tasks = this->queues[ownIndex]->tasks;
+          if (!tasks.empty())
+          {
+            task = std::move(tasks.back());
+            tasks.pop_back();
+            --this->pendingTasks;
+            return true;
+          }
+        }
+
+        // Steal the oldest task of another queue
+        for (unsigned int i = 1; i < kQueueCount; ++i)
+        {
+          auto& victim = *this->queues[(ownIndex + i) % kQueueCount];
+          std::lock_guard<std::mutex> lock(victim.mutex);
+          if (!victim.tasks.empty())
+          {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --this->pendingTasks;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      void WorkerLoop(unsigned int index)
+      {
+        CurrentPool() = this;
+        CurrentIndex() = index;
+
+        while (true)
+        {
+          if (this->RunPendingTask())
+            continue;
+
+          // Sleep until new tasks are submitted or the pool is stopped
+          std::unique_lock<std::mutex> lock(this->sleepMutex);
+          this->sleepCondition.wait(lock, [this]
+            { return this->isStopping || this->pendingTasks.load() > 0; });
+          if (this->isStopping && this->pendingTasks.load() <= 0)
+            return;
+        }
+      }
+
+      std::vector<std::unique_ptr<WorkerQueue>> queues;  // One queue per worker plus the external one
+      std::vector<std::thread> workers;                  // Worker threads
+      std::atomic<int> pendingTasks;                     // Number of tasks within the queues
+      std::mutex sleepMutex;                             // Protect idle workers sleeping
+      std::condition_variable sleepCondition;            // Wake up idle workers
+      bool isStopping;                                   // Workers should terminate
+  };
+
+  /// @class TaskGroup
+  ///
+  /// Fork-join helper: run tasks on a ThreadPool and wait for all of them to complete.
+  /// The first exception thrown by a task is forwarded to the waiting thread.
+  class TaskGroup
+  {
+    public:
+      explicit TaskGroup(ThreadPool& pool) : pool(pool), runningTasks(0) {}
+
+      /// Wait for the remaining tasks before destruction.
+      ~TaskGroup()
+      {
+        while (this->runningTasks.load() > 0)
+          if (!this->pool.RunPendingTask())
+            std::this_thread::yield();
+      }
+
+      /// Fork a task on the pool.
+      ///
+      /// @param task callable to be run by the pool.
+      ///
+      /// @return void.
+      void Run(std::function<void()> task)
+      {
+        ++this->runningTasks;
+        this->pool.Submit([this, task]()
+        {
+          try
+          {
+            task();
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> lock(this->exceptionMutex);
+            if (!this->exception)
+              this->exception = std::current_exception();
+          }
+          --this->runningTasks;
+        });
+      }
+
+      /// Join all the forked tasks, running pending tasks of the pool meanwhile.
+      /// Rethrow the first exception raised by a task, if any.
+      ///
+      /// @return void.
+      void Wait()
+      {
+        while (this->runningTasks.load() > 0)
+          if (!this->pool.RunPendingTask())
+            std::this_thread::yield();
+
+        if (this->exception)
+        {
+          auto exception = this->exception;
+          this->exception = nullptr;
+          std::rethrow_exception(exception);
+        }
+      }
+
+    private:
+      TaskGroup(const TaskGroup&);            // Not implemented
+      TaskGroup& operator=(const TaskGroup&); // Not implemented
+
+      ThreadPool& pool;                 // Pool running the tasks
+      std::atomic<int> runningTasks;    // Forked tasks not completed yet
+      std::mutex exceptionMutex;        // Protect the exception
+      std::exception_ptr exception;     // First exception thrown by a task
+  };
+
+  /// @class Barrier
+  ///
+  /// Reusable synchronization point of a fixed number of threads: Wait blocks until all the threads reach it,
+  /// the writes done by any thread before the barrier being visible to all the others after it.
+  class Barrier
+  {
+    public:
+      explicit Barrier(const unsigned int threadCount) : threadCount(threadCount), waitingThreads(0), generation(0) {}
+
+      /// Wait for all the threads to reach the barrier.
+      ///
+      /// @return void.
+      void Wait()
+      {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        const auto currentGeneration = this->generation;
+        if (++this->waitingThreads == this->threadCount)
+        {
+          this->waitingThreads = 0;
+          ++this->generation;
+          this->condition.notify_all();
+          return;
+        }
+
+        this->condition.wait(lock, [this, currentGeneration]() { return this->generation != currentGeneration; });
+      }
+
+    private:
+      Barrier(const Barrier&);            // Not implemented
+      Barrier& operator=(const Barrier&); // Not implemented
+
+      const unsigned int threadCount;     // Number of threads to be synchronized
+      unsigned int waitingThreads;        // Threads waiting for the current generation
+      unsigned int generation;            // Number of times the barrier has been released
+      std::mutex mutex;                   // Protect the counters
+      std::condition_variable condition;  // Wake up the waiting threads
+  };
+}
+
+#endif // MODULE_SORT_THREAD_POOL_HXX
@@ -0,0 +1,57 @@
+/*===========================================================================================================
+ *
+ * SHA - Simple Hybesis Algorithms
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_TRAITS_HXX
+#define MODULE_SORT_TRAITS_HXX
+
+// STD includes
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SHA_Sort
+{
+  /// IsContiguousIterator - Determine whether an iterator type walks through contiguous memory:
+  /// raw pointers, std::vector (except std::vector<bool>) and std::string iterators.
+  ///
+  /// @tparam IT type using to go through the collection.
+  template <typename IT,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsContiguousIterator : std::integral_constant<bool,
+    std::is_pointer<IT>::value ||
+    (!std::is_same<Value, bool>::value &&
+     (std::is_same<IT, typename std::vector<Value>::iterator>::value ||
+      std::is_same<IT, typename std::vector<Value>::const_iterator>::value)) ||
+    std::is_same<IT, std::string::iterator>::value ||
+    std::is_same<IT, std::string::const_iterator>::value>
+  {};
+
+  /// IsContiguousArithmetic - Determine whether an iterator type walks through contiguous memory
+  /// of arithmetic values (bool excepted): eligible to branchless and vectorized kernels.
+  ///
+  /// @tparam IT type using to go through the collection.
+  template <typename IT,
+            typename Value = typename std::remove_cv<typename std::iterator_traits<IT>::value_type>::type>
+  struct IsContiguousArithmetic : std::integral_constant<bool,
+    IsContiguousIterator<IT>::value && std::is_arithmetic<Value>::value && !std::is_same<Value, bool>::value>
+  {};
+}
+
+#endif // MODULE_SORT_TRAITS_HXX